@@ -0,0 +1,181 @@
+/**
+ * @file arithmetic_bench.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Runtime benchmark of the numeric policies: every kernel runs once on raw
+ * doubles and once on strong units and the best time per element is printed.
+ * It is built with the fast policy (default) and with the checked policy
+ * (`STU_CHECKED_ARITHMETIC`), see `bench/BUILD`.
+ * Usage: arithmetic_bench [elements] [runs]
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/SIDerivedUnits.h"
+#include "src/lib/SICoherentBaseUnits.h"
+#include "src/lib/StrongUnitChrono.h"
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace stu
+{
+    DEF_UNIT(quantity::length, kilometer, STU_UNIT_TYPE, _km, scale::kilo)
+    DEF_UNIT(quantity::time, nanosecond, STU_UNIT_TYPE, _ns, scale::nano)
+}
+
+namespace
+{
+    double value(double raw) { return raw; }
+
+    template <typename TY, typename QU, typename SC, typename LA>
+    double value(stu::Unit<TY, QU, SC, LA> const &unit) { return unit(); }
+
+    struct raw_types
+    {
+        using length = double;
+        using klength = double;
+        using mass = double;
+        using velocity = double;
+        using energy = double;
+
+        static klength to_kilometer(length const &value) { return value / 1000.0; }
+    };
+
+    struct unit_types
+    {
+        using length = stu::meter;
+        using klength = stu::kilometer;
+        using mass = stu::gram;
+        using velocity = stu::meter_per_second;
+        using energy = stu::joule;
+
+        static klength to_kilometer(length const &value) { return value; }
+    };
+
+    template <typename TYPES>
+    struct kernels
+    {
+        using length = typename TYPES::length;
+        using klength = typename TYPES::klength;
+        using mass = typename TYPES::mass;
+        using velocity = typename TYPES::velocity;
+        using energy = typename TYPES::energy;
+
+        std::vector<length> x_;
+        std::vector<length> y_;
+        std::vector<klength> k_;
+        std::vector<mass> m_;
+        std::vector<velocity> v_;
+        std::vector<energy> e_;
+
+        explicit kernels(std::size_t size) : x_(size), y_(size), k_(size), m_(size), v_(size), e_(size)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                x_[i] = length{1.0 + static_cast<double>(i % 1000)};
+                y_[i] = length{2.0};
+                m_[i] = mass{0.5 + static_cast<double>(i % 100)};
+                v_[i] = velocity{static_cast<double>(i % 300)};
+            }
+        }
+
+        void scale()
+        {
+            length const *x = x_.data();
+            length *y = y_.data();
+            for (std::size_t i = 0, size = x_.size(); i < size; ++i)
+                y[i] = 1.1 * x[i] / 3.0;
+        }
+
+        void axpy()
+        {
+            length const *x = x_.data();
+            length *y = y_.data();
+            for (std::size_t i = 0, size = x_.size(); i < size; ++i)
+                y[i] = 0.25 * x[i] + y[i];
+        }
+
+        void conversion()
+        {
+            length const *x = x_.data();
+            klength *k = k_.data();
+            for (std::size_t i = 0, size = x_.size(); i < size; ++i)
+                k[i] = TYPES::to_kilometer(x[i]);
+        }
+
+        void kinetic_energy()
+        {
+            mass const *m = m_.data();
+            velocity const *v = v_.data();
+            energy *e = e_.data();
+            for (std::size_t i = 0, size = x_.size(); i < size; ++i)
+                e[i] = 0.5 * m[i] * v[i] * v[i];
+        }
+
+        double checksum() const
+        {
+            return value(y_.back()) + value(k_.back()) + value(e_.back());
+        }
+    };
+
+    // best time per element of a kernel in nanoseconds
+    template <typename KERNELS>
+    double measure(KERNELS &data, void (KERNELS::*kernel)(), int runs)
+    {
+        stu::nanosecond best{1e300};
+        for (int run = 0; run < runs; ++run)
+        {
+            stu::Stopwatch<stu::nanosecond> stopwatch;
+            (data.*kernel)();
+            best = stu::min(best, stopwatch.elapsed());
+        }
+        return best() / static_cast<double>(data.x_.size());
+    }
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    std::size_t const size = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1U << 16;
+    int const runs = (argc > 2) ? std::atoi(argv[2]) : 200;
+    if (size == 0 || runs <= 0)
+    {
+        std::fprintf(stderr, "usage: %s [elements] [runs]\n", argv[0]);
+        return 1;
+    }
+
+    kernels<raw_types> raw{size};
+    kernels<unit_types> unit{size};
+
+#ifdef STU_CHECKED_ARITHMETIC
+    std::printf("numeric policy: checked, %zu elements, best of %d runs\n", size, runs);
+#else
+    std::printf("numeric policy: fast, %zu elements, best of %d runs\n", size, runs);
+#endif
+    std::printf("%-16s %12s %12s %8s\n", "kernel", "raw ns/el", "unit ns/el", "ratio");
+
+    struct
+    {
+        char const *name;
+        void (kernels<raw_types>::*raw)();
+        void (kernels<unit_types>::*unit)();
+    } const cases[] = {
+        {"scale", &kernels<raw_types>::scale, &kernels<unit_types>::scale},
+        {"axpy", &kernels<raw_types>::axpy, &kernels<unit_types>::axpy},
+        {"conversion", &kernels<raw_types>::conversion, &kernels<unit_types>::conversion},
+        {"kinetic_energy", &kernels<raw_types>::kinetic_energy, &kernels<unit_types>::kinetic_energy},
+    };
+
+    for (auto const &bench : cases)
+    {
+        double const raw_time = measure(raw, bench.raw, runs);
+        double const unit_time = measure(unit, bench.unit, runs);
+        std::printf("%-16s %12.3f %12.3f %8.2f\n", bench.name, raw_time, unit_time, unit_time / raw_time);
+    }
+
+    // the checksums keep the kernels alive
+    std::printf("checksum: raw %.6g, unit %.6g\n", raw.checksum(), unit.checksum());
+    return 0;
+}
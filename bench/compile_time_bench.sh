@@ -0,0 +1,51 @@
+#!/bin/bash
+#
+# @file compile_time_bench.sh
+# @author Massimo Mattelliano (mattemax@yahoo.com)
+# @brief
+# Compile-time benchmark for StrongUnit.
+# It compiles `compile_time_tu.cpp` several times and reports the best wall time
+# and the peak memory of the compiler (GNU time is used when available).
+# Usage: compile_time_bench.sh [runs] [extra compiler flags...]
+# @copyright Copyright (c) 2022
+# MIT License
+
+set -u
+
+if [ -n "${BUILD_WORKSPACE_DIRECTORY:-}" ]; then
+    ROOT="${BUILD_WORKSPACE_DIRECTORY}"
+else
+    ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+fi
+CXX="${CXX:-c++}"
+RUNS="${1:-3}"
+shift $(($# > 0 ? 1 : 0))
+WORK="$(mktemp -d "${TMPDIR:-/tmp}/stu_compile_bench.XXXXXX")"
+trap 'rm -rf "${WORK}"' EXIT
+
+GNU_TIME=""
+if [ -x /usr/bin/time ] && /usr/bin/time -f "%e" true > /dev/null 2>&1; then
+    GNU_TIME=/usr/bin/time
+fi
+
+BEST=""
+PEAK="n/a"
+for RUN in $(seq 1 "${RUNS}"); do
+    START=$(date +%s.%N)
+    if [ -n "${GNU_TIME}" ]; then
+        "${GNU_TIME}" -f "%M" -o "${WORK}/mem" "${CXX}" -std=c++14 -I"${ROOT}" "$@" \
+            -c "${ROOT}/bench/compile_time_tu.cpp" -o "${WORK}/tu.o" || exit 1
+        PEAK="$(cat "${WORK}/mem") KB"
+    else
+        "${CXX}" -std=c++14 -I"${ROOT}" "$@" -c "${ROOT}/bench/compile_time_tu.cpp" -o "${WORK}/tu.o" || exit 1
+    fi
+    END=$(date +%s.%N)
+    ELAPSED=$(awk -v s="${START}" -v e="${END}" 'BEGIN { printf "%.2f", e - s }')
+    echo "run ${RUN}: ${ELAPSED} s"
+    BEST=$(awk -v b="${BEST:-${ELAPSED}}" -v e="${ELAPSED}" 'BEGIN { print (e < b) ? e : b }')
+done
+
+echo "compiler     : $("${CXX}" --version | head -n 1)"
+echo "best time    : ${BEST} s"
+echo "peak memory  : ${PEAK}"
+echo "object size  : $(wc -c < "${WORK}/tu.o") bytes"
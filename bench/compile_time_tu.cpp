@@ -0,0 +1,135 @@
+/**
+ * @file compile_time_tu.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Expression-heavy translation unit used by the compile-time benchmark.
+ * Every pair of a set of units is multiplied and divided, then a
+ * set of physics formulas combines the derived quantities further.
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/NonSIBaseUnits.h"
+#include "src/lib/SISpecialDerivedUnits.h"
+#include <initializer_list>
+
+using namespace stu::literals;
+using namespace stu::symbols;
+using namespace stu::prefixes;
+
+template <typename FIRST, typename... OTHERS>
+double row(FIRST const &first, OTHERS const &...others)
+{
+    double res{0};
+    auto pair = [&res, &first](auto const &second)
+    {
+        res += ((first * second) / (second * first))();
+        res += ((first / second) * (second / first))();
+        return 0;
+    };
+    (void)std::initializer_list<int>{pair(others)...};
+    return res;
+}
+
+template <typename... UNITS>
+double pairs(UNITS const &...units)
+{
+    double res{0};
+    (void)std::initializer_list<int>{(res += row(units, units...), 0)...};
+    return res;
+}
+
+stu::watt electric_power(stu::volt const &V, stu::ampere const &I, stu::ohm const &Z)
+{
+    stu::watt P1 = V * I;
+    stu::watt P2 = Z * stu::pow<2>(I);
+    stu::watt P3 = stu::pow<2>(V) / Z;
+    return (P1 + P2 + P3) / 3.0;
+}
+
+stu::joule kinetic_energy(stu::kilogram const &m, stu::meter_per_second const &v)
+{
+    return 0.5 * m * stu::pow<2>(v);
+}
+
+stu::second pendulum_period(stu::meter const &length, stu::meter_per_second_squared const &g)
+{
+    return 2 * 3.14159265358979323 * stu::sqrt(length / g);
+}
+
+stu::pascal ideal_gas_pressure(stu::mole const &n, stu::kelvin const &T, stu::cubic_meter const &V)
+{
+    auto R = 8.314462618 * _J / (_mol * _K);
+    return n * R * T / V;
+}
+
+stu::newton lorentz_force(stu::coulomb const &q, stu::meter_per_second const &v, stu::tesla const &B)
+{
+    return q * v * B;
+}
+
+stu::henry solenoid_inductance(stu::henry_per_meter const &mu, stu::meter const &length, stu::square_meter const &area)
+{
+    return mu * area / length * 1000.0;
+}
+
+stu::farad plate_capacitance(stu::farad_per_meter const &eps, stu::square_meter const &area, stu::meter const &gap)
+{
+    return eps * area / gap;
+}
+
+stu::hertz lc_resonance(stu::henry const &L, stu::farad const &C)
+{
+    return 1 / (2 * 3.14159265358979323 * stu::sqrt(L * C));
+}
+
+stu::watt_per_square_meter heat_flux(stu::watt const &P, stu::square_meter const &area)
+{
+    return P / area;
+}
+
+stu::kilogram_per_cubic_meter density(stu::kilogram const &m, stu::liter const &V)
+{
+    return m / V;
+}
+
+stu::meter_per_second terminal_velocity(stu::kilogram const &m, stu::meter_per_second_squared const &g,
+                                        stu::kilogram_per_cubic_meter const &rho, stu::square_meter const &area)
+{
+    return stu::sqrt(2 * m * g / (rho * area * 0.47));
+}
+
+stu::joule_per_mole molar_work(stu::pascal const &p, stu::cubic_meter const &V, stu::mole const &n)
+{
+    return p * V / n;
+}
+
+stu::weber flux(stu::tesla const &B, stu::hectare const &area)
+{
+    return B * area;
+}
+
+stu::volt induced_voltage(stu::weber const &dPhi, stu::minute const &dt)
+{
+    return dPhi / dt;
+}
+
+int main()
+{
+    auto P = electric_power(230.0_V, 10.0_A, 23.0_ohm);
+    auto E = kinetic_energy(1.0_kg, 3.0_mps);
+    auto T = pendulum_period(1.0_m, 9.81_mps2);
+    auto p = ideal_gas_pressure(1.0_mol, 273.15_K, 0.0224_m3);
+    auto F = lorentz_force(1.0_C, 1.0_mps, 1.0_T);
+    auto L = solenoid_inductance(1.0_Hpm, 1.0_m, 1.0_m2);
+    auto C = plate_capacitance(1.0_Fpm, 1.0_m2, 1.0_m);
+    auto f = lc_resonance(L, C);
+    auto q = heat_flux(P, 1.0_m2);
+    auto rho = density(1.0_kg, 1.0_L);
+    auto v = terminal_velocity(80.0_kg, 9.81_mps2, rho, 0.7_m2);
+    auto w = molar_work(p, 1.0_m3, 1.0_mol);
+    auto U = induced_voltage(flux(1.0_T, 1.0_ha), 1.0_min);
+    auto pp = pairs(_s, _m, _kg, _A, _K, _mol, _cd, _N, _J, _W, _V, _ohm, _F, _H, _T, _Pa);
+    return static_cast<int>(pp + P() + E() + T() + p() + F() + f() + q() + v() + w() + U()) & 1;
+}
@@ -31,6 +31,7 @@
 #define NONSIBASEUNITS_H
 
 #include "SICoherentBaseUnits.h"
+#include "StrongAffineUnit.h"
 
 namespace stu
 {
@@ -43,18 +44,25 @@ namespace stu
         DEF_SCALE(sq_m2ha, 10000U)
         DEF_SCALE(cb_m2L, 1U, 1000U)
         DEF_SCALE(g2t, 1000000U)
+        DEF_SCALE(K2Ra, 5U, 9U)
     }
 
     /**
      * Non-SI base units accepted for use with SI units
      */
-    DEF_UNIT(quantity::time, minute, STU_UNIT_TYPE, _min, scale::s2min)
-    DEF_UNIT(quantity::time, hour, STU_UNIT_TYPE, _h, scale::s2hour)
-    DEF_UNIT(quantity::time, day, STU_UNIT_TYPE, _d, scale::s2day)
-    DEF_UNIT(quantity::plane_angle, degree, STU_UNIT_TYPE, _deg, scale::num2deg)
-    DEF_UNIT(quantity::area, hectare, STU_UNIT_TYPE, _ha, scale::sq_m2ha)
-    DEF_UNIT(quantity::volume, liter, STU_UNIT_TYPE, _L, scale::cb_m2L)
-    DEF_UNIT(quantity::mass, tonne, STU_UNIT_TYPE, _t, scale::g2t)
+    DEF_NAMED_UNIT(quantity::time, minute, STU_UNIT_TYPE, _min, scale::s2min)
+    DEF_NAMED_UNIT(quantity::time, hour, STU_UNIT_TYPE, _h, scale::s2hour)
+    DEF_NAMED_UNIT(quantity::time, day, STU_UNIT_TYPE, _d, scale::s2day)
+    DEF_NAMED_UNIT(quantity::plane_angle, degree, STU_UNIT_TYPE, _deg, scale::num2deg)
+    DEF_NAMED_UNIT(quantity::area, hectare, STU_UNIT_TYPE, _ha, scale::sq_m2ha)
+    DEF_NAMED_UNIT(quantity::volume, liter, STU_UNIT_TYPE, _L, scale::cb_m2L)
+    DEF_NAMED_UNIT(quantity::mass, tonne, STU_UNIT_TYPE, _t, scale::g2t)
+
+    /**
+     * Non-SI temperature units (degree Fahrenheit points have a 459.67 degree Rankine origin)
+     */
+    DEF_NAMED_UNIT(quantity::temperature, rankine, STU_UNIT_TYPE, _Ra, scale::K2Ra)
+    DEF_AFFINE_UNIT(fahrenheit, rankine, _Fdeg, std::ratio<45967, 180>)
 
 } // namespace stu
 
@@ -59,12 +59,8 @@ namespace stu
         DEF_SCALE(peta, 1000000000000000)
         DEF_SCALE(exa, 1000000000000000000)
 
-        DEF_SCALE(num2rad,
-                  50000000000000000U,
-                  314159265358979323U)
-        DEF_SCALE(num2sr,
-                  25000000000000000U,
-                  314159265358979323U)
+        DEF_SCALE(num2rad, 1U, 2U, -1)
+        DEF_SCALE(num2sr, 1U, 4U, -1)
         ///@endcond
     } // namespace scale
 
@@ -88,6 +84,17 @@ namespace stu
         ///@endcond
     }
 
+    /**
+     * SI Base quantities labels of unnamed derived units
+     */
+    DEF_BASE_LABEL(0, _s)
+    DEF_BASE_LABEL(1, _m)
+    DEF_BASE_LABEL(2, _g)
+    DEF_BASE_LABEL(3, _A)
+    DEF_BASE_LABEL(4, _K)
+    DEF_BASE_LABEL(5, _mol)
+    DEF_BASE_LABEL(6, _cd)
+
     /**
      * SI Prefix numeral unit and constants are defined
      */
@@ -112,16 +119,16 @@ namespace stu
     /**
      * SI Base Units
      */
-    DEF_UNIT(quantity::time, second, STU_UNIT_TYPE, _s, scale::unity)
-    DEF_UNIT(quantity::length, meter, STU_UNIT_TYPE, _m, scale::unity)
-    DEF_UNIT(quantity::mass, gram, STU_UNIT_TYPE, _g, scale::unity)
-    DEF_UNIT(quantity::mass, kilogram, STU_UNIT_TYPE, _kg, scale::kilo)
-    DEF_UNIT(quantity::electric_current, ampere, STU_UNIT_TYPE, _A, scale::unity)
-    DEF_UNIT(quantity::temperature, kelvin, STU_UNIT_TYPE, _K, scale::unity)
-    DEF_UNIT(quantity::substance_amount, mole, STU_UNIT_TYPE, _mol, scale::unity)
-    DEF_UNIT(quantity::luminous_intensity, candela, STU_UNIT_TYPE, _cd, scale::unity)
-    DEF_UNIT(quantity::plane_angle, radian, STU_UNIT_TYPE, _rad, scale::num2rad)
-    DEF_UNIT(quantity::solid_angle, steradian, STU_UNIT_TYPE, _sr, scale::num2sr)
+    DEF_NAMED_UNIT(quantity::time, second, STU_UNIT_TYPE, _s, scale::unity)
+    DEF_NAMED_UNIT(quantity::length, meter, STU_UNIT_TYPE, _m, scale::unity)
+    DEF_NAMED_UNIT(quantity::mass, gram, STU_UNIT_TYPE, _g, scale::unity)
+    DEF_NAMED_UNIT(quantity::mass, kilogram, STU_UNIT_TYPE, _kg, scale::kilo)
+    DEF_NAMED_UNIT(quantity::electric_current, ampere, STU_UNIT_TYPE, _A, scale::unity)
+    DEF_NAMED_UNIT(quantity::temperature, kelvin, STU_UNIT_TYPE, _K, scale::unity)
+    DEF_NAMED_UNIT(quantity::substance_amount, mole, STU_UNIT_TYPE, _mol, scale::unity)
+    DEF_NAMED_UNIT(quantity::luminous_intensity, candela, STU_UNIT_TYPE, _cd, scale::unity)
+    DEF_NAMED_UNIT(quantity::plane_angle, radian, STU_UNIT_TYPE, _rad, scale::num2rad)
+    DEF_NAMED_UNIT(quantity::solid_angle, steradian, STU_UNIT_TYPE, _sr, scale::num2sr)
 } // namespace stu
 
 #endif // SIBASEUNITS_H
\ No newline at end of file
@@ -57,19 +57,20 @@ namespace stu
 
     /**
      * SI Coherent Base Units
+     * @note candela per square meter is an alias, since it has the same quantity and scale of lux.
      */
-    DEF_UNIT(quantity::area, square_meter, STU_UNIT_TYPE, _m2, scale::unity)
-    DEF_UNIT(quantity::volume, cubic_meter, STU_UNIT_TYPE, _m3, scale::unity)
-    DEF_UNIT(quantity::velocity, meter_per_second, STU_UNIT_TYPE, _mps, scale::unity)
-    DEF_UNIT(quantity::acceleration, meter_per_second_squared, STU_UNIT_TYPE, _mps2, scale::unity)
-    DEF_UNIT(quantity::wavenumber, reciprocal_meter, STU_UNIT_TYPE, _m_1, scale::unity)
-    DEF_UNIT(quantity::density, gram_per_cubic_meter, STU_UNIT_TYPE, _gpm3, scale::unity)
-    DEF_UNIT(quantity::surface_density, gram_per_square_meter, STU_UNIT_TYPE, _gpm2, scale::unity)
-    DEF_UNIT(quantity::density, kilogram_per_cubic_meter, STU_UNIT_TYPE, _kgpm3, scale::kilo)
-    DEF_UNIT(quantity::surface_density, kilogram_per_square_meter, STU_UNIT_TYPE, _kgpm2, scale::kilo)
-    DEF_UNIT(quantity::specific_volume, cubic_meter_per_gram, STU_UNIT_TYPE, _m3pg, scale::unity)
-    DEF_UNIT(quantity::magnetic_field_strength, ampere_per_meter, STU_UNIT_TYPE, _Apm, scale::unity)
-    DEF_UNIT(quantity::concentration, mole_per_cubic_meter, STU_UNIT_TYPE, _molpm3, scale::unity)
+    DEF_NAMED_UNIT(quantity::area, square_meter, STU_UNIT_TYPE, _m2, scale::unity)
+    DEF_NAMED_UNIT(quantity::volume, cubic_meter, STU_UNIT_TYPE, _m3, scale::unity)
+    DEF_NAMED_UNIT(quantity::velocity, meter_per_second, STU_UNIT_TYPE, _mps, scale::unity)
+    DEF_NAMED_UNIT(quantity::acceleration, meter_per_second_squared, STU_UNIT_TYPE, _mps2, scale::unity)
+    DEF_NAMED_UNIT(quantity::wavenumber, reciprocal_meter, STU_UNIT_TYPE, _m_1, scale::unity)
+    DEF_NAMED_UNIT(quantity::density, gram_per_cubic_meter, STU_UNIT_TYPE, _gpm3, scale::unity)
+    DEF_NAMED_UNIT(quantity::surface_density, gram_per_square_meter, STU_UNIT_TYPE, _gpm2, scale::unity)
+    DEF_NAMED_UNIT(quantity::density, kilogram_per_cubic_meter, STU_UNIT_TYPE, _kgpm3, scale::kilo)
+    DEF_NAMED_UNIT(quantity::surface_density, kilogram_per_square_meter, STU_UNIT_TYPE, _kgpm2, scale::kilo)
+    DEF_NAMED_UNIT(quantity::specific_volume, cubic_meter_per_gram, STU_UNIT_TYPE, _m3pg, scale::unity)
+    DEF_NAMED_UNIT(quantity::magnetic_field_strength, ampere_per_meter, STU_UNIT_TYPE, _Apm, scale::unity)
+    DEF_NAMED_UNIT(quantity::concentration, mole_per_cubic_meter, STU_UNIT_TYPE, _molpm3, scale::unity)
     DEF_UNIT(quantity::luminance, candela_per_square_meter, STU_UNIT_TYPE, _cdpm2, scale::unity)
 
 } // namespace stu
@@ -31,6 +31,7 @@
 #define SIDERIVEDUNITS_H
 
 #include "SIBaseUnits.h"
+#include "StrongAffineUnit.h"
 
 namespace stu
 {
@@ -64,27 +65,34 @@ namespace stu
 
     /**
      * SI Derived Units
+     * @note units having the same quantity and scale of another unit (e.g. becquerel and hertz)
+     *       are defined by DEF_UNIT, derived unit operations yield the DEF_NAMED_UNIT one.
      */
-    DEF_UNIT(quantity::frequency, hertz, STU_UNIT_TYPE, _Hz, scale::unity)
-    DEF_UNIT(quantity::force, newton, STU_UNIT_TYPE, _N, scale::unity)
-    DEF_UNIT(quantity::pressure, pascal, STU_UNIT_TYPE, _Pa, scale::unity)
-    DEF_UNIT(quantity::energy, joule, STU_UNIT_TYPE, _J, scale::unity)
-    DEF_UNIT(quantity::power, watt, STU_UNIT_TYPE, _W, scale::unity)
-    DEF_UNIT(quantity::electric_charge, coulomb, STU_UNIT_TYPE, _C, scale::unity)
-    DEF_UNIT(quantity::voltage, volt, STU_UNIT_TYPE, _V, scale::unity)
-    DEF_UNIT(quantity::electrical_capacitance, farad, STU_UNIT_TYPE, _F, scale::unity)
-    DEF_UNIT(quantity::electrical_impedance, ohm, STU_UNIT_TYPE, _ohm, scale::unity)
-    DEF_UNIT(quantity::electrical_conductance, siemens, STU_UNIT_TYPE, _S, scale::unity)
-    DEF_UNIT(quantity::magnetic_flux, weber, STU_UNIT_TYPE, _Wb, scale::unity)
-    DEF_UNIT(quantity::magnetic_field, tesla, STU_UNIT_TYPE, _T, scale::unity)
-    DEF_UNIT(quantity::inductance, henry, STU_UNIT_TYPE, _H, scale::unity)
-    DEF_UNIT(quantity::temperature, celsius, STU_UNIT_TYPE, _Cdeg, scale::unity)
+    DEF_NAMED_UNIT(quantity::frequency, hertz, STU_UNIT_TYPE, _Hz, scale::unity)
+    DEF_NAMED_UNIT(quantity::force, newton, STU_UNIT_TYPE, _N, scale::unity)
+    DEF_NAMED_UNIT(quantity::pressure, pascal, STU_UNIT_TYPE, _Pa, scale::unity)
+    DEF_NAMED_UNIT(quantity::energy, joule, STU_UNIT_TYPE, _J, scale::unity)
+    DEF_NAMED_UNIT(quantity::power, watt, STU_UNIT_TYPE, _W, scale::unity)
+    DEF_NAMED_UNIT(quantity::electric_charge, coulomb, STU_UNIT_TYPE, _C, scale::unity)
+    DEF_NAMED_UNIT(quantity::voltage, volt, STU_UNIT_TYPE, _V, scale::unity)
+    DEF_NAMED_UNIT(quantity::electrical_capacitance, farad, STU_UNIT_TYPE, _F, scale::unity)
+    DEF_NAMED_UNIT(quantity::electrical_impedance, ohm, STU_UNIT_TYPE, _ohm, scale::unity)
+    DEF_NAMED_UNIT(quantity::electrical_conductance, siemens, STU_UNIT_TYPE, _S, scale::unity)
+    DEF_NAMED_UNIT(quantity::magnetic_flux, weber, STU_UNIT_TYPE, _Wb, scale::unity)
+    DEF_NAMED_UNIT(quantity::magnetic_field, tesla, STU_UNIT_TYPE, _T, scale::unity)
+    DEF_NAMED_UNIT(quantity::inductance, henry, STU_UNIT_TYPE, _H, scale::unity)
     DEF_UNIT(quantity::luminous_flux, lumen, STU_UNIT_TYPE, _lm, scale::unity)
-    DEF_UNIT(quantity::illuminance, lux, STU_UNIT_TYPE, _lx, scale::unity)
+    DEF_NAMED_UNIT(quantity::illuminance, lux, STU_UNIT_TYPE, _lx, scale::unity)
     DEF_UNIT(quantity::radioactivity, becquerel, STU_UNIT_TYPE, _Bq, scale::unity)
-    DEF_UNIT(quantity::absorbed_dose, gray, STU_UNIT_TYPE, _Gy, scale::unity)
+    DEF_NAMED_UNIT(quantity::absorbed_dose, gray, STU_UNIT_TYPE, _Gy, scale::unity)
     DEF_UNIT(quantity::equivalent_dose, sievert, STU_UNIT_TYPE, _Sv, scale::unity)
-    DEF_UNIT(quantity::catalytic_activity, katal, STU_UNIT_TYPE, _kat, scale::unity)
+    DEF_NAMED_UNIT(quantity::catalytic_activity, katal, STU_UNIT_TYPE, _kat, scale::unity)
+
+    /**
+     * SI Derived affine Units
+     * @note degree Celsius points have a 273.15 K origin, their differences are kelvin.
+     */
+    DEF_AFFINE_UNIT(celsius, kelvin, _Cdeg, std::ratio<27315, 100>)
 
 } // namespace stu
 
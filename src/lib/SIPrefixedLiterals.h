@@ -0,0 +1,111 @@
+/**
+ * @file SIPrefixedLiterals.h
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * International System prefixed literals of base and derived units
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SIPREFIXEDLITERALS_H
+#define SIPREFIXEDLITERALS_H
+
+#include "SIDerivedUnits.h"
+
+/**
+ * @brief
+ * Defines the SI prefixed literals of a strong unit, e.g. `_km`, `_mm` and `_mcm` from `meter` and `m`.
+ * @note a prefixed literal has its own label, e.g. `1_km` and the symbol product `k_*_m` have the same
+ *       quantity and scale but they are different types (labels `_km` and the unnamed derived label).
+ */
+#define DEF_PREFIXED_LITERALS(a_unit, symbol)                   \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, a, stu::scale::atto)   \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, f, stu::scale::femto)  \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, p, stu::scale::pico)   \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, n, stu::scale::nano)   \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, mc, stu::scale::micro) \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, m, stu::scale::milli)  \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, c, stu::scale::centi)  \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, d, stu::scale::deci)   \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, da, stu::scale::deca)  \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, h, stu::scale::hecto)  \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, k, stu::scale::kilo)   \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, M, stu::scale::mega)   \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, G, stu::scale::giga)   \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, T, stu::scale::tera)   \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, P, stu::scale::peta)   \
+    DEF_PREFIXED_LITERAL(a_unit, symbol, E, stu::scale::exa)
+
+namespace stu
+{
+    /**
+     * SI Base Units prefixed literals (`_kg` is already defined as kilogram literal)
+     */
+    DEF_PREFIXED_LITERALS(second, s)
+    DEF_PREFIXED_LITERALS(meter, m)
+    DEF_PREFIXED_LITERAL(gram, g, a, scale::atto)
+    DEF_PREFIXED_LITERAL(gram, g, f, scale::femto)
+    DEF_PREFIXED_LITERAL(gram, g, p, scale::pico)
+    DEF_PREFIXED_LITERAL(gram, g, n, scale::nano)
+    DEF_PREFIXED_LITERAL(gram, g, mc, scale::micro)
+    DEF_PREFIXED_LITERAL(gram, g, m, scale::milli)
+    DEF_PREFIXED_LITERAL(gram, g, c, scale::centi)
+    DEF_PREFIXED_LITERAL(gram, g, d, scale::deci)
+    DEF_PREFIXED_LITERAL(gram, g, da, scale::deca)
+    DEF_PREFIXED_LITERAL(gram, g, h, scale::hecto)
+    DEF_PREFIXED_LITERAL(gram, g, M, scale::mega)
+    DEF_PREFIXED_LITERAL(gram, g, G, scale::giga)
+    DEF_PREFIXED_LITERAL(gram, g, T, scale::tera)
+    DEF_PREFIXED_LITERAL(gram, g, P, scale::peta)
+    DEF_PREFIXED_LITERAL(gram, g, E, scale::exa)
+    DEF_PREFIXED_LITERALS(ampere, A)
+    DEF_PREFIXED_LITERALS(kelvin, K)
+    DEF_PREFIXED_LITERALS(mole, mol)
+    DEF_PREFIXED_LITERALS(candela, cd)
+    DEF_PREFIXED_LITERALS(radian, rad)
+
+    /**
+     * SI Derived Units prefixed literals
+     */
+    DEF_PREFIXED_LITERALS(hertz, Hz)
+    DEF_PREFIXED_LITERALS(newton, N)
+    DEF_PREFIXED_LITERALS(pascal, Pa)
+    DEF_PREFIXED_LITERALS(joule, J)
+    DEF_PREFIXED_LITERALS(watt, W)
+    DEF_PREFIXED_LITERALS(coulomb, C)
+    DEF_PREFIXED_LITERALS(volt, V)
+    DEF_PREFIXED_LITERALS(farad, F)
+    DEF_PREFIXED_LITERALS(ohm, ohm)
+    DEF_PREFIXED_LITERALS(siemens, S)
+    DEF_PREFIXED_LITERALS(weber, Wb)
+    DEF_PREFIXED_LITERALS(tesla, T)
+    DEF_PREFIXED_LITERALS(henry, H)
+    DEF_PREFIXED_LITERALS(lumen, lm)
+    DEF_PREFIXED_LITERALS(lux, lx)
+    DEF_PREFIXED_LITERALS(becquerel, Bq)
+    DEF_PREFIXED_LITERALS(gray, Gy)
+    DEF_PREFIXED_LITERALS(sievert, Sv)
+    DEF_PREFIXED_LITERALS(katal, kat)
+} // namespace stu
+
+#endif // SIPREFIXEDLITERALS_H
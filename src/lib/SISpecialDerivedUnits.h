@@ -54,14 +54,14 @@ namespace stu
     /**
      * SI Special Derived Units
      */
-    DEF_UNIT(quantity::dynamic_viscosity, pascal_second, STU_UNIT_TYPE, _Pas, scale::unity)
-    DEF_UNIT(quantity::angular_velocity, radian_per_second, STU_UNIT_TYPE, _radps, scale::num2rad)
-    DEF_UNIT(quantity::angular_acceleration, radian_per_second_squared, STU_UNIT_TYPE, _radps2, scale::num2rad)
-    DEF_UNIT(quantity::irradiance, watt_per_square_meter, STU_UNIT_TYPE, _Wpm2, scale::unity)
-    DEF_UNIT(quantity::electric_field, volt_per_meter, STU_UNIT_TYPE, _Vpm, scale::unity)
-    DEF_UNIT(quantity::electric_permittivity, farad_per_meter, STU_UNIT_TYPE, _Fpm, scale::unity)
-    DEF_UNIT(quantity::magnetic_permeability, henry_per_meter, STU_UNIT_TYPE, _Hpm, scale::unity)
-    DEF_UNIT(quantity::molar_energy, joule_per_mole, STU_UNIT_TYPE, _Jpmol, scale::kilo)
+    DEF_NAMED_UNIT(quantity::dynamic_viscosity, pascal_second, STU_UNIT_TYPE, _Pas, scale::unity)
+    DEF_NAMED_UNIT(quantity::angular_velocity, radian_per_second, STU_UNIT_TYPE, _radps, scale::num2rad)
+    DEF_NAMED_UNIT(quantity::angular_acceleration, radian_per_second_squared, STU_UNIT_TYPE, _radps2, scale::num2rad)
+    DEF_NAMED_UNIT(quantity::irradiance, watt_per_square_meter, STU_UNIT_TYPE, _Wpm2, scale::unity)
+    DEF_NAMED_UNIT(quantity::electric_field, volt_per_meter, STU_UNIT_TYPE, _Vpm, scale::unity)
+    DEF_NAMED_UNIT(quantity::electric_permittivity, farad_per_meter, STU_UNIT_TYPE, _Fpm, scale::unity)
+    DEF_NAMED_UNIT(quantity::magnetic_permeability, henry_per_meter, STU_UNIT_TYPE, _Hpm, scale::unity)
+    DEF_NAMED_UNIT(quantity::molar_energy, joule_per_mole, STU_UNIT_TYPE, _Jpmol, scale::kilo)
 
 } // namespace stu
 
@@ -0,0 +1,160 @@
+/**
+ * @file SIUnitsInstances.h
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Explicit instantiation declarations of the SI named units and of their conversions.
+ * Including this header (and linking `//src/lib:SIUnitsInstances`) avoids instantiating
+ * and compiling them in each translation unit.
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SIUNITSINSTANCES_H
+#define SIUNITSINSTANCES_H
+
+#include "NonSIBaseUnits.h"
+#include "SISpecialDerivedUnits.h"
+
+/**
+ * @brief
+ * Explicit instantiation prefix: declarations in user code, definitions in `SIUnitsInstances.cpp`.
+ */
+#ifdef STU_INSTANTIATE_UNITS
+#define STU_INSTANCE template
+#else
+#define STU_INSTANCE extern template
+#endif
+
+/**
+ * @brief
+ * Explicit instantiation of a strong unit class.
+ * @note member functions are implicitly inline, so they are still inlined where optimizations are enabled.
+ */
+#define STU_UNIT_INSTANCES(a_unit) \
+    STU_INSTANCE class stu::Unit<a_unit::type, a_unit::quantity, a_unit::scale, a_unit::label>;
+
+/**
+ * @brief
+ * Explicit instantiation of the linear conversions between two units of the same quantity.
+ */
+#define STU_CONVERSION_INSTANCES(a_unit, other_unit)  \
+    STU_INSTANCE a_unit::operator other_unit() const; \
+    STU_INSTANCE other_unit::operator a_unit() const;
+
+/// @cond
+/**
+ * SI Base Units
+ */
+STU_UNIT_INSTANCES(stu::second)
+STU_UNIT_INSTANCES(stu::meter)
+STU_UNIT_INSTANCES(stu::gram)
+STU_UNIT_INSTANCES(stu::kilogram)
+STU_UNIT_INSTANCES(stu::ampere)
+STU_UNIT_INSTANCES(stu::kelvin)
+STU_UNIT_INSTANCES(stu::mole)
+STU_UNIT_INSTANCES(stu::candela)
+STU_UNIT_INSTANCES(stu::radian)
+STU_UNIT_INSTANCES(stu::steradian)
+
+/**
+ * SI Coherent Base Units
+ */
+STU_UNIT_INSTANCES(stu::square_meter)
+STU_UNIT_INSTANCES(stu::cubic_meter)
+STU_UNIT_INSTANCES(stu::meter_per_second)
+STU_UNIT_INSTANCES(stu::meter_per_second_squared)
+STU_UNIT_INSTANCES(stu::reciprocal_meter)
+STU_UNIT_INSTANCES(stu::gram_per_cubic_meter)
+STU_UNIT_INSTANCES(stu::gram_per_square_meter)
+STU_UNIT_INSTANCES(stu::kilogram_per_cubic_meter)
+STU_UNIT_INSTANCES(stu::kilogram_per_square_meter)
+STU_UNIT_INSTANCES(stu::cubic_meter_per_gram)
+STU_UNIT_INSTANCES(stu::ampere_per_meter)
+STU_UNIT_INSTANCES(stu::mole_per_cubic_meter)
+STU_UNIT_INSTANCES(stu::candela_per_square_meter)
+
+/**
+ * SI Derived Units
+ */
+STU_UNIT_INSTANCES(stu::hertz)
+STU_UNIT_INSTANCES(stu::newton)
+STU_UNIT_INSTANCES(stu::pascal)
+STU_UNIT_INSTANCES(stu::joule)
+STU_UNIT_INSTANCES(stu::watt)
+STU_UNIT_INSTANCES(stu::coulomb)
+STU_UNIT_INSTANCES(stu::volt)
+STU_UNIT_INSTANCES(stu::farad)
+STU_UNIT_INSTANCES(stu::ohm)
+STU_UNIT_INSTANCES(stu::siemens)
+STU_UNIT_INSTANCES(stu::weber)
+STU_UNIT_INSTANCES(stu::tesla)
+STU_UNIT_INSTANCES(stu::henry)
+STU_UNIT_INSTANCES(stu::lumen)
+STU_UNIT_INSTANCES(stu::lux)
+STU_UNIT_INSTANCES(stu::becquerel)
+STU_UNIT_INSTANCES(stu::gray)
+STU_UNIT_INSTANCES(stu::sievert)
+STU_UNIT_INSTANCES(stu::katal)
+
+/**
+ * SI Special Derived Units
+ */
+STU_UNIT_INSTANCES(stu::pascal_second)
+STU_UNIT_INSTANCES(stu::radian_per_second)
+STU_UNIT_INSTANCES(stu::radian_per_second_squared)
+STU_UNIT_INSTANCES(stu::watt_per_square_meter)
+STU_UNIT_INSTANCES(stu::volt_per_meter)
+STU_UNIT_INSTANCES(stu::farad_per_meter)
+STU_UNIT_INSTANCES(stu::henry_per_meter)
+STU_UNIT_INSTANCES(stu::joule_per_mole)
+
+/**
+ * Non-SI base units accepted for use with SI units
+ */
+STU_UNIT_INSTANCES(stu::minute)
+STU_UNIT_INSTANCES(stu::hour)
+STU_UNIT_INSTANCES(stu::day)
+STU_UNIT_INSTANCES(stu::degree)
+STU_UNIT_INSTANCES(stu::hectare)
+STU_UNIT_INSTANCES(stu::liter)
+STU_UNIT_INSTANCES(stu::tonne)
+
+/**
+ * Conversions
+ */
+STU_CONVERSION_INSTANCES(stu::second, stu::minute)
+STU_CONVERSION_INSTANCES(stu::second, stu::hour)
+STU_CONVERSION_INSTANCES(stu::second, stu::day)
+STU_CONVERSION_INSTANCES(stu::minute, stu::hour)
+STU_CONVERSION_INSTANCES(stu::hour, stu::day)
+STU_CONVERSION_INSTANCES(stu::gram, stu::kilogram)
+STU_CONVERSION_INSTANCES(stu::gram, stu::tonne)
+STU_CONVERSION_INSTANCES(stu::kilogram, stu::tonne)
+STU_CONVERSION_INSTANCES(stu::radian, stu::degree)
+STU_CONVERSION_INSTANCES(stu::square_meter, stu::hectare)
+STU_CONVERSION_INSTANCES(stu::cubic_meter, stu::liter)
+STU_CONVERSION_INSTANCES(stu::gram_per_cubic_meter, stu::kilogram_per_cubic_meter)
+STU_CONVERSION_INSTANCES(stu::gram_per_square_meter, stu::kilogram_per_square_meter)
+///@endcond
+
+#endif // SIUNITSINSTANCES_H
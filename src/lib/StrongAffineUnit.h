@@ -0,0 +1,310 @@
+/**
+ * @file StrongAffineUnit.h
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Affine Strong Unit implementation (units whose zero is offset, e.g. degree Celsius)
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STRONGAFFINEUNIT_H
+#define STRONGAFFINEUNIT_H
+
+#include <cstddef>
+#include "StrongUnit.h"
+
+/**
+ * @brief
+ * Defines an affine strong unit, i.e. a point scale whose differences are expressed by `a_difference`
+ * and whose zero is the trailing std::ratio argument (origin) in base units of the same quantity.
+ */
+#define DEF_AFFINE_UNIT(a_unit, a_difference, label, ...)                  \
+    namespace tag                                                          \
+    {                                                                      \
+        struct label                                                       \
+        {                                                                  \
+            static constexpr char const *name() { return #label; }         \
+        };                                                                 \
+    }                                                                      \
+    using a_unit = stu::AffineUnit<a_difference, __VA_ARGS__, tag::label>; \
+    namespace literals                                                     \
+    {                                                                      \
+        constexpr a_unit operator"" label(long double val)                 \
+        {                                                                  \
+            return a_unit{static_cast<a_difference::type>(val)};           \
+        }                                                                  \
+        constexpr a_unit operator"" label(unsigned long long val)          \
+        {                                                                  \
+            return a_unit{static_cast<a_difference::type>(val)};           \
+        }                                                                  \
+    }
+
+namespace stu
+{
+    /// @cond
+    namespace utils /* Utilities to convert affine units */
+    {
+        /*
+         * Affine conversion from the point scale (SC1, O1) to (SC2, O2) of the same quantity:
+         * v2 = v1 * factor_ + offset_ where factor_ = SC1/SC2 and offset_ = (O1 - O2)/SC2.
+         * Both constants are computed at compile time, so a conversion is one multiply-add
+         * (contracted into a fused multiply-add where the target supports it).
+         */
+        template <typename TY, typename SC1, typename O1, typename SC2, typename O2>
+        struct affine_conversion
+        {
+            using scale = div_scales_t<SC1, SC2>;
+            using offset = std::ratio_multiply<std::ratio_subtract<O1, O2>, std::ratio<SC2::dn_, SC2::up_>>;
+
+            static constexpr TY factor_ = static_cast<TY>(scale_value<scale>());
+            static constexpr TY offset_ = static_cast<TY>(1.0L * offset::num / offset::den * pi_power(-SC2::pi_));
+
+            static constexpr TY apply(TY value)
+            {
+                return value * factor_ + offset_;
+            }
+        };
+    } // namespace utils
+    ///@endcond
+
+    /**
+     * @brief
+     * Class template representing an affine strong unit, i.e. a point of a scale whose zero is
+     * offset from the zero of the base unit, such as degree Celsius and degree Fahrenheit.
+     * Point and difference types are distinct: the difference of two points is a `UNIT`,
+     * a point plus or minus a `UNIT` is a point, points are compared only with points.
+     * @note In the operators a strong unit of the same quantity (e.g. kelvin) is always a difference, only the
+     *       conversions read it as an absolute temperature (origin zero), e.g. `stu::celsius{300.0_K}`.
+     * @tparam UNIT     strong unit of the differences between points (e.g. kelvin for degree Celsius)
+     * @tparam ORIGIN   zero of the scale in base units of the quantity (std::ratio)
+     * @tparam LABEL    label type for tagging printed units
+     */
+    template <typename UNIT, typename ORIGIN, typename LABEL>
+    class AffineUnit final
+    {
+    public:
+        using type = typename UNIT::type;
+        using quantity = typename UNIT::quantity;
+        using scale = typename UNIT::scale;
+        using origin = ORIGIN;
+        using label = LABEL;
+        using difference = UNIT;
+
+    private:
+        type value_{};
+
+    public:
+        constexpr explicit AffineUnit(type value = 0) : value_{value} {}
+        AffineUnit(AffineUnit const &other) = default;
+        AffineUnit(AffineUnit &&other) noexcept = default;
+        ~AffineUnit() = default;
+
+        /**
+         * @brief
+         * Implicit conversion from an absolute strong unit point of the same quantity (e.g. kelvin),
+         * explicit with `STU_EXPLICIT_CONVERSIONS`
+         */
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        STU_CONVERSION_SPECIFIER AffineUnit(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &absolute)
+            : value_{utils::affine_conversion<type, OTHER_SCALE, std::ratio<0>, scale, ORIGIN>::apply(absolute())}
+        {
+        }
+
+        AffineUnit &operator=(AffineUnit other) noexcept
+        {
+            value_ = other.value_;
+            return *this;
+        }
+
+        /**
+         * @brief `operator()`.
+         * It returns the type wrapped by this class
+         */
+        constexpr type operator()() const { return value_; }
+
+        /**
+         * @brief Prints an affine unit information.
+         * @note It requires `StrongUnitIO.h`.
+         */
+        void print() const
+        {
+            print_unit(*this);
+        }
+
+        /**
+         * @brief
+         * Implicit conversion to another affine unit of the same quantity, i.e. `v*factor + offset`
+         */
+        template <typename OTHER_SCALE, typename OTHER_DIFFERENCE_LABEL, typename OTHER_ORIGIN, typename OTHER_LABEL>
+        STU_CONVERSION_SPECIFIER operator AffineUnit<Unit<type, quantity, OTHER_SCALE, OTHER_DIFFERENCE_LABEL>, OTHER_ORIGIN, OTHER_LABEL>() const
+        {
+            return AffineUnit<Unit<type, quantity, OTHER_SCALE, OTHER_DIFFERENCE_LABEL>, OTHER_ORIGIN, OTHER_LABEL>{
+                utils::affine_conversion<type, scale, ORIGIN, OTHER_SCALE, OTHER_ORIGIN>::apply(value_)};
+        }
+
+        /**
+         * @brief
+         * Implicit conversion to an absolute strong unit point of the same quantity (e.g. kelvin)
+         */
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        STU_CONVERSION_SPECIFIER operator Unit<type, quantity, OTHER_SCALE, OTHER_LABEL>() const
+        {
+            return Unit<type, quantity, OTHER_SCALE, OTHER_LABEL>{
+                utils::affine_conversion<type, scale, ORIGIN, OTHER_SCALE, std::ratio<0>>::apply(value_)};
+        }
+
+        /**
+         * @brief
+         * Unary minus negates the point value, it allows negative literals (e.g. `-40.0_Cdeg`)
+         */
+        constexpr AffineUnit operator-() const
+        {
+            return AffineUnit{-value_};
+        }
+
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        AffineUnit &operator+=(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &difference)
+        {
+            STU_ASSERT_NO_CONVERSION(OTHER_SCALE, scale);
+            value_ += static_cast<UNIT>(difference)();
+            return *this;
+        }
+
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        AffineUnit &operator-=(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &difference)
+        {
+            STU_ASSERT_NO_CONVERSION(OTHER_SCALE, scale);
+            value_ -= static_cast<UNIT>(difference)();
+            return *this;
+        }
+
+    }; // AffineUnit
+
+    /**
+     * @brief It allows point-point of the same quantity, the result is the difference unit of the first point.
+     */
+    template <typename UN, typename OR, typename LA, typename SC, typename DLA, typename OR2, typename LA2>
+    UN operator-(AffineUnit<UN, OR, LA> const &first,
+                 AffineUnit<Unit<typename UN::type, typename UN::quantity, SC, DLA>, OR2, LA2> const &second)
+    {
+        STU_ASSERT_NO_CONVERSION(AffineUnit<Unit<typename UN::type, typename UN::quantity, SC, DLA>, OR2, LA2>,
+                                 AffineUnit<UN, OR, LA>);
+        return UN{first() - static_cast<AffineUnit<UN, OR, LA>>(second)()};
+    }
+
+    /**
+     * @brief It allows point+difference.
+     */
+    template <typename UN, typename OR, typename LA, typename SC, typename DLA>
+    AffineUnit<UN, OR, LA> operator+(AffineUnit<UN, OR, LA> first,
+                                     Unit<typename UN::type, typename UN::quantity, SC, DLA> const &second)
+    {
+        first += second;
+        return first;
+    }
+
+    /**
+     * @brief It allows difference+point.
+     */
+    template <typename UN, typename OR, typename LA, typename SC, typename DLA>
+    AffineUnit<UN, OR, LA> operator+(Unit<typename UN::type, typename UN::quantity, SC, DLA> const &first,
+                                     AffineUnit<UN, OR, LA> second)
+    {
+        second += first;
+        return second;
+    }
+
+    /**
+     * @brief It allows point-difference.
+     */
+    template <typename UN, typename OR, typename LA, typename SC, typename DLA>
+    AffineUnit<UN, OR, LA> operator-(AffineUnit<UN, OR, LA> first,
+                                     Unit<typename UN::type, typename UN::quantity, SC, DLA> const &second)
+    {
+        first -= second;
+        return first;
+    }
+
+    /*
+     * Comparisons of points of the same quantity, a linear unit (a difference) is not a point.
+     */
+    template <typename UN, typename OR, typename LA, typename SC, typename DLA, typename OR2, typename LA2>
+    bool operator<(AffineUnit<UN, OR, LA> const &left,
+                   AffineUnit<Unit<typename UN::type, typename UN::quantity, SC, DLA>, OR2, LA2> const &right)
+    {
+        STU_ASSERT_NO_CONVERSION(AffineUnit<Unit<typename UN::type, typename UN::quantity, SC, DLA>, OR2, LA2>,
+                                 AffineUnit<UN, OR, LA>);
+        return (left() < static_cast<AffineUnit<UN, OR, LA>>(right)());
+    }
+
+    template <typename UN, typename OR, typename LA, typename SC, typename DLA, typename OR2, typename LA2>
+    bool operator>(AffineUnit<UN, OR, LA> const &left,
+                   AffineUnit<Unit<typename UN::type, typename UN::quantity, SC, DLA>, OR2, LA2> const &right)
+    {
+        STU_ASSERT_NO_CONVERSION(AffineUnit<Unit<typename UN::type, typename UN::quantity, SC, DLA>, OR2, LA2>,
+                                 AffineUnit<UN, OR, LA>);
+        return (left() > static_cast<AffineUnit<UN, OR, LA>>(right)());
+    }
+
+    template <typename UN, typename OR, typename LA, typename SC, typename DLA, typename OR2, typename LA2>
+    bool operator<=(AffineUnit<UN, OR, LA> const &left,
+                    AffineUnit<Unit<typename UN::type, typename UN::quantity, SC, DLA>, OR2, LA2> const &right)
+    {
+        return (!(left > right));
+    }
+
+    template <typename UN, typename OR, typename LA, typename SC, typename DLA, typename OR2, typename LA2>
+    bool operator>=(AffineUnit<UN, OR, LA> const &left,
+                    AffineUnit<Unit<typename UN::type, typename UN::quantity, SC, DLA>, OR2, LA2> const &right)
+    {
+        return (!(left < right));
+    }
+
+    template <typename UN, typename OR, typename LA, typename SC, typename DLA, typename OR2, typename LA2>
+    bool operator==(AffineUnit<UN, OR, LA> const &left,
+                    AffineUnit<Unit<typename UN::type, typename UN::quantity, SC, DLA>, OR2, LA2> const &right)
+    {
+        return (!(left < right) && !(left > right));
+    }
+
+    template <typename UN, typename OR, typename LA, typename SC, typename DLA, typename OR2, typename LA2>
+    bool operator!=(AffineUnit<UN, OR, LA> const &left,
+                    AffineUnit<Unit<typename UN::type, typename UN::quantity, SC, DLA>, OR2, LA2> const &right)
+    {
+        return ((left < right) || (left > right));
+    }
+
+    /**
+     * @brief It converts `size` values from `in` to `out`, e.g. an array of degree Celsius to degree Fahrenheit.
+     * @note Affine conversions are one multiply-add per value and the loop is vectorizable.
+     */
+    template <typename FROM, typename TO>
+    void convert(FROM const *in, TO *out, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            out[i] = static_cast<TO>(in[i]);
+    }
+
+} // namespace stu
+
+#endif // STRONGAFFINEUNIT_H
@@ -0,0 +1,395 @@
+/**
+ * @file StrongAtomicUnit.h
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Atomic Strong Unit and sharded accumulator implementation
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STRONGATOMICUNIT_H
+#define STRONGATOMICUNIT_H
+
+#include <atomic>
+#include <cstddef>
+#include "StrongUnit.h"
+
+/**
+ * @brief
+ * It specifies the alignment of the ShardedAccumulator slots, i.e. the destructive interference size of the target.
+ */
+#ifndef STU_CACHE_LINE_SIZE
+#define STU_CACHE_LINE_SIZE 64
+#endif
+
+namespace stu
+{
+    /// @cond
+    namespace utils /* Utilities for atomic units */
+    {
+        /*
+         * Atomic floating-point add: std::atomic<TY>::fetch_add where the library provides it
+         * (C++20), otherwise a compare-and-swap loop. compare_exchange_weak compares the bit
+         * patterns of the stored and expected values, so the loop also terminates on NaN.
+         */
+        template <typename TY>
+        TY atomic_fetch_add(std::atomic<TY> &value, TY delta, std::memory_order order) noexcept
+        {
+#if defined(__cpp_lib_atomic_float)
+            return value.fetch_add(delta, order);
+#else
+            TY expected = value.load(std::memory_order_relaxed);
+            while (!value.compare_exchange_weak(expected, expected + delta, order, std::memory_order_relaxed))
+            {
+            }
+            return expected;
+#endif
+        }
+
+        /*
+         * Rounding error of the floating-point sum a + b (Knuth TwoSum), i.e. a + b - fl(a + b) exactly.
+         * It requires IEEE arithmetic (no -ffast-math).
+         */
+        template <typename TY>
+        TY two_sum_error(TY a, TY b) noexcept
+        {
+            TY const sum = a + b;
+            TY const b_part = sum - a;
+            return (a - (sum - b_part)) + (b - b_part);
+        }
+
+        /*
+         * Index of the calling thread among the threads that used a sharded accumulator,
+         * assigned round-robin on first use.
+         */
+        inline std::size_t thread_shard_index() noexcept
+        {
+            static std::atomic<std::size_t> next{0};
+            thread_local std::size_t const index = next.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+
+        /*
+         * Atomic add to a strong unit total. With STU_CHECKED_ARITHMETIC a compare-and-swap loop stores
+         * only a finite sum, otherwise it throws arithmetic_error and leaves the total unchanged.
+         */
+        template <typename LABEL, typename TY>
+        TY checked_fetch_add(std::atomic<TY> &value, TY delta, std::memory_order order,
+                             char const *operation) STU_NOEXCEPT_UNCHECKED
+        {
+#ifdef STU_CHECKED_ARITHMETIC
+            TY expected = value.load(std::memory_order_relaxed);
+            while (!value.compare_exchange_weak(expected, check_finite<LABEL>(expected + delta, operation),
+                                                order, std::memory_order_relaxed))
+            {
+            }
+            return expected;
+#else
+            static_cast<void>(operation);
+            return atomic_fetch_add(value, delta, order);
+#endif
+        }
+    } // namespace utils
+    ///@endcond
+
+    /**
+     * @brief
+     * Class template representing a strong unit whose value is read and modified atomically,
+     * e.g. an energy or a time total accumulated by many threads.
+     * Values of other units of the same quantity are converted to `UNIT` before they are stored or added.
+     * @note It is lock-free when `std::atomic<UNIT::type>` is (float and double on common targets, see `is_lock_free`).
+     *       With `STU_CHECKED_ARITHMETIC` an add whose sum is not finite throws `arithmetic_error` and leaves the
+     *       value unchanged, and the members building units are not `noexcept`.
+     * @tparam UNIT strong unit of the stored value (e.g. joule)
+     */
+    template <typename UNIT>
+    class AtomicUnit final
+    {
+    public:
+        using unit = UNIT;
+        using type = typename UNIT::type;
+        using quantity = typename UNIT::quantity;
+        using scale = typename UNIT::scale;
+        using label = typename UNIT::label;
+
+    private:
+        std::atomic<type> value_;
+
+    public:
+#if defined(__cpp_lib_atomic_is_always_lock_free)
+        static constexpr bool is_always_lock_free = std::atomic<type>::is_always_lock_free;
+#endif
+
+        constexpr explicit AtomicUnit(type value = 0) noexcept : value_{value} {}
+
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        explicit AtomicUnit(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &value) STU_NOEXCEPT_UNCHECKED
+            : value_{static_cast<UNIT>(value)()}
+        {
+        }
+
+        AtomicUnit(AtomicUnit const &other) = delete;
+        AtomicUnit &operator=(AtomicUnit const &other) = delete;
+        ~AtomicUnit() = default;
+
+        bool is_lock_free() const noexcept { return value_.is_lock_free(); }
+
+        UNIT load(std::memory_order order = std::memory_order_seq_cst) const STU_NOEXCEPT_UNCHECKED
+        {
+            return UNIT{value_.load(order)};
+        }
+
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        void store(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &value,
+                   std::memory_order order = std::memory_order_seq_cst) STU_NOEXCEPT_UNCHECKED
+        {
+            value_.store(static_cast<UNIT>(value)(), order);
+        }
+
+        /**
+         * @brief It stores `value` and returns the previous one.
+         */
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        UNIT exchange(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &value,
+                      std::memory_order order = std::memory_order_seq_cst) STU_NOEXCEPT_UNCHECKED
+        {
+            return UNIT{value_.exchange(static_cast<UNIT>(value)(), order)};
+        }
+
+        /**
+         * @brief
+         * It stores `desired` if the current value is bitwise equal to `expected`,
+         * otherwise it loads the current value into `expected`. It may fail spuriously.
+         */
+        bool compare_exchange_weak(UNIT &expected, UNIT desired,
+                                   std::memory_order order = std::memory_order_seq_cst) STU_NOEXCEPT_UNCHECKED
+        {
+            type value = expected();
+            bool const exchanged = value_.compare_exchange_weak(value, desired(), order);
+            expected = UNIT{value};
+            return exchanged;
+        }
+
+        /**
+         * @brief
+         * It stores `desired` if the current value is bitwise equal to `expected`,
+         * otherwise it loads the current value into `expected`.
+         */
+        bool compare_exchange_strong(UNIT &expected, UNIT desired,
+                                     std::memory_order order = std::memory_order_seq_cst) STU_NOEXCEPT_UNCHECKED
+        {
+            type value = expected();
+            bool const exchanged = value_.compare_exchange_strong(value, desired(), order);
+            expected = UNIT{value};
+            return exchanged;
+        }
+
+        /**
+         * @brief It adds `delta` (converted to `UNIT`) and returns the previous value.
+         */
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        UNIT fetch_add(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &delta,
+                       std::memory_order order = std::memory_order_seq_cst) STU_NOEXCEPT_UNCHECKED
+        {
+            return UNIT{utils::checked_fetch_add<label>(value_, static_cast<UNIT>(delta)(), order, "AtomicUnit::fetch_add")};
+        }
+
+        /**
+         * @brief It subtracts `delta` (converted to `UNIT`) and returns the previous value.
+         */
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        UNIT fetch_sub(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &delta,
+                       std::memory_order order = std::memory_order_seq_cst) STU_NOEXCEPT_UNCHECKED
+        {
+            return UNIT{utils::checked_fetch_add<label>(value_, -static_cast<UNIT>(delta)(), order, "AtomicUnit::fetch_sub")};
+        }
+
+        operator UNIT() const STU_NOEXCEPT_UNCHECKED { return load(); }
+
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        UNIT operator=(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &value) STU_NOEXCEPT_UNCHECKED
+        {
+            UNIT const converted = static_cast<UNIT>(value);
+            value_.store(converted());
+            return converted;
+        }
+
+        /**
+         * @brief It adds `delta` atomically and returns the new value.
+         */
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        UNIT operator+=(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &delta) STU_NOEXCEPT_UNCHECKED
+        {
+            STU_ASSERT_NO_CONVERSION(OTHER_SCALE, scale);
+            type const converted = static_cast<UNIT>(delta)();
+            return UNIT{utils::checked_fetch_add<label>(value_, converted, std::memory_order_seq_cst, "AtomicUnit::operator+=") +
+                        converted};
+        }
+
+        /**
+         * @brief It subtracts `delta` atomically and returns the new value.
+         */
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        UNIT operator-=(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &delta) STU_NOEXCEPT_UNCHECKED
+        {
+            STU_ASSERT_NO_CONVERSION(OTHER_SCALE, scale);
+            type const converted = -static_cast<UNIT>(delta)();
+            return UNIT{utils::checked_fetch_add<label>(value_, converted, std::memory_order_seq_cst, "AtomicUnit::operator-=") +
+                        converted};
+        }
+
+    }; // AtomicUnit
+
+    /**
+     * @brief
+     * Summation algorithm of a ShardedAccumulator:
+     * `plain` adds values to the shard sum, `compensated` also accumulates the rounding error of every add.
+     */
+    enum class summation
+    {
+        plain,
+        compensated
+    };
+
+    /**
+     * @brief
+     * Class template representing a strong unit total updated by many threads, e.g. a metering counter.
+     * Each thread adds to one of `SHARDS` cache-line aligned slots (threads are assigned to slots round-robin),
+     * so concurrent adds from different threads do not contend on one cache line. `load()` merges the slots.
+     * @note Adds are lock-free relaxed atomic operations. `load()` is not a snapshot: adds running concurrently
+     *       may or may not be included. Heap allocation of over-aligned types requires C++17 aligned `new`.
+     *       With `STU_CHECKED_ARITHMETIC` an add making a slot sum not finite throws `arithmetic_error`.
+     * @tparam UNIT      strong unit of the total (e.g. joule)
+     * @tparam SHARDS    number of slots, ideally not less than the number of threads adding concurrently
+     * @tparam SUMMATION `summation::compensated` keeps the rounding errors of every add and of the merge
+     */
+    template <typename UNIT, std::size_t SHARDS = 64, summation SUMMATION = summation::plain>
+    class ShardedAccumulator final
+    {
+        static_assert(SHARDS > 0, "==>> SHARDED ACCUMULATOR REQUIRES AT LEAST ONE SHARD! <<==");
+
+    public:
+        using unit = UNIT;
+        using type = typename UNIT::type;
+        using quantity = typename UNIT::quantity;
+        using scale = typename UNIT::scale;
+        using label = typename UNIT::label;
+
+    private:
+        struct alignas(STU_CACHE_LINE_SIZE) Shard
+        {
+            std::atomic<type> sum_{0};
+            std::atomic<type> compensation_{0};
+        };
+
+        Shard shards_[SHARDS];
+
+        void add_value(type value, char const *operation) STU_NOEXCEPT_UNCHECKED
+        {
+            Shard &shard = shards_[utils::thread_shard_index() % SHARDS];
+            type const previous = utils::checked_fetch_add<label>(shard.sum_, value, std::memory_order_relaxed, operation);
+            if (SUMMATION == summation::compensated)
+                utils::atomic_fetch_add(shard.compensation_, utils::two_sum_error(previous, value), std::memory_order_relaxed);
+        }
+
+    public:
+        ShardedAccumulator() noexcept = default;
+        ShardedAccumulator(ShardedAccumulator const &other) = delete;
+        ShardedAccumulator &operator=(ShardedAccumulator const &other) = delete;
+        ~ShardedAccumulator() = default;
+
+        static constexpr std::size_t shards() { return SHARDS; }
+
+        /**
+         * @brief It adds `delta` (converted to `UNIT`) to the slot of the calling thread.
+         */
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        void add(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &delta) STU_NOEXCEPT_UNCHECKED
+        {
+            add_value(static_cast<UNIT>(delta)(), "ShardedAccumulator::add");
+        }
+
+        /**
+         * @brief It subtracts `delta` (converted to `UNIT`) from the slot of the calling thread.
+         */
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        void sub(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &delta) STU_NOEXCEPT_UNCHECKED
+        {
+            add_value(-static_cast<UNIT>(delta)(), "ShardedAccumulator::sub");
+        }
+
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        ShardedAccumulator &operator+=(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &delta) STU_NOEXCEPT_UNCHECKED
+        {
+            STU_ASSERT_NO_CONVERSION(OTHER_SCALE, scale);
+            add(delta);
+            return *this;
+        }
+
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        ShardedAccumulator &operator-=(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &delta) STU_NOEXCEPT_UNCHECKED
+        {
+            STU_ASSERT_NO_CONVERSION(OTHER_SCALE, scale);
+            sub(delta);
+            return *this;
+        }
+
+        /**
+         * @brief It returns the sum of all the slots.
+         */
+        UNIT load() const STU_NOEXCEPT_UNCHECKED
+        {
+            type total{0};
+            type compensation{0};
+            for (Shard const &shard : shards_)
+            {
+                type const value = shard.sum_.load(std::memory_order_relaxed);
+                if (SUMMATION == summation::compensated)
+                {
+                    compensation += utils::two_sum_error(total, value) + shard.compensation_.load(std::memory_order_relaxed);
+                }
+                total += value;
+            }
+            return UNIT{total + compensation};
+        }
+
+        operator UNIT() const STU_NOEXCEPT_UNCHECKED { return load(); }
+
+        /**
+         * @brief It sets all the slots to zero.
+         * @note Adds running concurrently may be lost.
+         */
+        void reset() noexcept
+        {
+            for (Shard &shard : shards_)
+            {
+                shard.sum_.store(0, std::memory_order_relaxed);
+                shard.compensation_.store(0, std::memory_order_relaxed);
+            }
+        }
+
+    }; // ShardedAccumulator
+
+} // namespace stu
+
+#endif // STRONGATOMICUNIT_H
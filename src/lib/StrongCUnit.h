@@ -64,17 +64,17 @@ namespace stu
         CUnit(CUnit &&other) noexcept = default;
         ~CUnit() = default;
 
-        CUnit &operator=(CUnit other) noexcept
+        constexpr CUnit &operator=(CUnit other) noexcept
         {
             real_ = other.real_;
             imag_ = other.imag_;
             return *this;
         }
 
-        UNIT real() const { return real_; }
-        UNIT imag() const { return imag_; }
+        constexpr UNIT real() const { return real_; }
+        constexpr UNIT imag() const { return imag_; }
 
-        CUnit conj() const
+        constexpr CUnit conj() const
         {
             CUnit res{};
             res.real_ = real_;
@@ -82,36 +82,43 @@ namespace stu
             return res;
         }
 
-        auto norm() const
+        constexpr auto norm() const
         {
             return (real_ * real_ + imag_ * imag_);
         }
 
+        /**
+         * @brief Prints real and imaginary parts information to the standard output.
+         * @note It requires `StrongCUnitIO.h`.
+         */
         void print() const
         {
-            std::cout << "Re: ";
-            (*this).real().print();
-            std::cout << "Im: ";
-            (*this).imag().print();
+            print_unit(*this);
         }
 
-        template <typename UN>
-        friend std::istream &operator>>(std::istream &is, CUnit<UN> &a_cunit);
+#ifdef STU_EXPLICIT_CONVERSIONS
+        template <typename OTHER_LABEL>
+        constexpr operator CUnit<Unit<typename UNIT::type, typename UNIT::quantity, typename UNIT::scale, OTHER_LABEL>>() const
+        {
+            using other_unit = Unit<typename UNIT::type, typename UNIT::quantity, typename UNIT::scale, OTHER_LABEL>;
+            return CUnit<other_unit>{other_unit{real_()}, other_unit{imag_()}};
+        }
+#endif
 
         template <typename OTHER_UNIT>
-        operator CUnit<OTHER_UNIT>() const
+        STU_CONVERSION_SPECIFIER constexpr operator CUnit<OTHER_UNIT>() const
         {
-            return CUnit<OTHER_UNIT>{real_, imag_};
+            return CUnit<OTHER_UNIT>{static_cast<OTHER_UNIT>(real_), static_cast<OTHER_UNIT>(imag_)};
         }
 
-        CUnit &operator+=(CUnit const &other)
+        constexpr CUnit &operator+=(CUnit const &other)
         {
             real_ += other.real_;
             imag_ += other.imag_;
             return *this;
         }
 
-        CUnit &operator-=(CUnit const &other)
+        constexpr CUnit &operator-=(CUnit const &other)
         {
             real_ -= other.real_;
             imag_ -= other.imag_;
@@ -119,7 +126,7 @@ namespace stu
         }
 
         // prefix increment
-        CUnit &operator++()
+        constexpr CUnit &operator++()
         {
             ++real_;
             ++imag_++;
@@ -127,7 +134,7 @@ namespace stu
         }
 
         // postfix increment
-        CUnit operator++(int)
+        constexpr CUnit operator++(int)
         {
             CUnit old = *this;
             operator++();
@@ -135,7 +142,7 @@ namespace stu
         }
 
         // prefix decrement
-        CUnit &operator--()
+        constexpr CUnit &operator--()
         {
             --real_;
             --imag_;
@@ -143,7 +150,7 @@ namespace stu
         }
 
         // postfix decrement
-        CUnit operator--(int)
+        constexpr CUnit operator--(int)
         {
             CUnit old = *this;
             operator--();
@@ -158,53 +165,39 @@ namespace stu
     using cunit = stu::numeral_cunity<STU_UNIT_TYPE>;
 #endif
 
-    template <typename UN>
-    std::ostream &operator<<(std::ostream &os, CUnit<UN> const &a_cunit)
-    {
-        if (a_cunit.imag()() >= 0)
-            os << a_cunit.real() << "+j" << a_cunit.imag();
-        else
-            os << a_cunit.real() << "-j" << -1.0 * a_cunit.imag();
-        return os;
-    }
-
-    template <typename UN>
-    std::istream &operator>>(std::istream &is, CUnit<UN> &a_cunit)
-    {
-        is >> a_cunit.real_ >> a_cunit.imag_;
-        return is;
-    }
-
     template <typename UN1, typename UN2>
-    bool operator==(CUnit<UN1> const &left, CUnit<UN2> const &right)
+    constexpr bool operator==(CUnit<UN1> const &left, CUnit<UN2> const &right)
     {
         return ((left.real() == right.real()) && (left.imag() == right.imag()));
     }
 
     template <typename UN1, typename UN2>
-    bool operator!=(CUnit<UN1> const &left, CUnit<UN2> const &right)
+    constexpr bool operator!=(CUnit<UN1> const &left, CUnit<UN2> const &right)
     {
         return (!(left == right));
     }
 
     // OPE+
     template <typename UN1, typename UN2>
-    CUnit<UN1> operator+(CUnit<UN1> first, CUnit<UN2> const &second)
+    constexpr CUnit<UN1> operator+(CUnit<UN1> first, CUnit<UN2> const &second)
     {
+        STU_ASSERT_NO_CONVERSION(typename UN2::scale, typename UN1::scale);
         first += second;
         return first;
     }
 
     template <typename UN1, typename UN2>
-    CUnit<UN1> operator+(CUnit<UN1> first, UN2 const &second)
+    constexpr CUnit<UN1> operator+(CUnit<UN1> first, UN2 const &second)
     {
+        STU_ASSERT_NO_CONVERSION(typename UN2::scale, typename UN1::scale);
         first += CUnit<UN2>{second};
         return first;
     }
 
     template <typename UN1, typename UN2>
-    CUnit<UN1> operator+(UN1 const &first, CUnit<UN2> const &second)
+    constexpr CUnit<UN1> operator+(UN1 const &first, CUnit<UN2> const &second)
     {
+        STU_ASSERT_NO_CONVERSION(typename UN2::scale, typename UN1::scale);
         CUnit<UN1> cfirst{first};
         cfirst += second;
         return cfirst;
@@ -212,22 +205,25 @@ namespace stu
 
     // OPE-
     template <typename UN1, typename UN2>
-    CUnit<UN1> operator-(CUnit<UN1> first, CUnit<UN2> const &second)
+    constexpr CUnit<UN1> operator-(CUnit<UN1> first, CUnit<UN2> const &second)
     {
+        STU_ASSERT_NO_CONVERSION(typename UN2::scale, typename UN1::scale);
         first -= second;
         return first;
     }
 
     template <typename UN1, typename UN2>
-    CUnit<UN1> operator-(CUnit<UN1> first, UN2 const &second)
+    constexpr CUnit<UN1> operator-(CUnit<UN1> first, UN2 const &second)
     {
+        STU_ASSERT_NO_CONVERSION(typename UN2::scale, typename UN1::scale);
         first -= CUnit<UN2>{second};
         return first;
     }
 
     template <typename UN1, typename UN2>
-    CUnit<UN1> operator-(UN1 const &first, CUnit<UN2> const &second)
+    constexpr CUnit<UN1> operator-(UN1 const &first, CUnit<UN2> const &second)
     {
+        STU_ASSERT_NO_CONVERSION(typename UN2::scale, typename UN1::scale);
         CUnit<UN1> cfirst{first};
         cfirst -= second;
         return cfirst;
@@ -235,19 +231,19 @@ namespace stu
 
     // OPE*
     template <typename UN>
-    CUnit<UN> operator*(long double const &first, CUnit<UN> const &second)
+    constexpr CUnit<UN> operator*(long double const &first, CUnit<UN> const &second)
     {
         return CUnit<UN>{first * second.real(), first * second.imag()};
     }
 
     template <typename UN>
-    CUnit<UN> operator*(CUnit<UN> const &first, long double const &second)
+    constexpr CUnit<UN> operator*(CUnit<UN> const &first, long double const &second)
     {
         return CUnit<UN>{first.real() * second, first.imag() * second};
     }
 
     template <typename UN1, typename UN2>
-    auto operator*(UN1 const &first, CUnit<UN2> const &second)
+    constexpr auto operator*(UN1 const &first, CUnit<UN2> const &second)
     {
         auto unit_real = first * second.real();
         using unnamed_unit = decltype(unit_real);
@@ -255,7 +251,7 @@ namespace stu
     }
 
     template <typename UN1, typename UN2>
-    auto operator*(CUnit<UN1> const &first, UN2 const &second)
+    constexpr auto operator*(CUnit<UN1> const &first, UN2 const &second)
     {
         auto unit_real = first.real() * second;
         using unnamed_unit = decltype(unit_real);
@@ -263,7 +259,7 @@ namespace stu
     }
 
     template <typename UN1, typename UN2>
-    auto operator*(CUnit<UN1> const &first, CUnit<UN2> const &second)
+    constexpr auto operator*(CUnit<UN1> const &first, CUnit<UN2> const &second)
     {
         auto unit_real = first.real() * second.real();
         using unnamed_unit = decltype(unit_real);
@@ -273,13 +269,13 @@ namespace stu
 
     // OPE/
     template <typename UN>
-    CUnit<UN> operator/(CUnit<UN> const &numerator, long double const &denominator)
+    constexpr CUnit<UN> operator/(CUnit<UN> const &numerator, long double const &denominator)
     {
         return CUnit<UN>{numerator.real() / denominator, numerator.imag() / denominator};
     }
 
     template <typename UN1, typename UN2>
-    auto operator/(CUnit<UN1> const &numerator, UN2 const &denominator)
+    constexpr auto operator/(CUnit<UN1> const &numerator, UN2 const &denominator)
     {
         auto unit_real = numerator.real() / denominator;
         using unnamed_unit = decltype(unit_real);
@@ -287,7 +283,7 @@ namespace stu
     }
 
     template <typename UN1, typename UN2>
-    auto operator/(CUnit<UN1> const &numerator, CUnit<UN2> const &denominator)
+    constexpr auto operator/(CUnit<UN1> const &numerator, CUnit<UN2> const &denominator)
     {
         auto norm = denominator.norm();
         auto unit = numerator.real() / denominator.real();
@@ -297,7 +293,7 @@ namespace stu
     }
 
     template <typename UN>
-    auto operator/(long double const &numerator, CUnit<UN> const &denominator)
+    constexpr auto operator/(long double const &numerator, CUnit<UN> const &denominator)
     {
         using TY = decltype(denominator.real()());
         stu::numeral_unit<TY> num_unit{static_cast<TY>(numerator)};
@@ -306,7 +302,7 @@ namespace stu
     }
 
     template <typename UN1, typename UN2>
-    auto operator/(UN1 const &numerator, CUnit<UN2> const &denominator)
+    constexpr auto operator/(UN1 const &numerator, CUnit<UN2> const &denominator)
     {
         CUnit<decltype(numerator)> num_cunit{numerator};
         return (num_cunit / denominator);
@@ -314,206 +310,442 @@ namespace stu
 
     // MATH FUNCTIONS
     template <typename UN>
-    auto getComplex(CUnit<UN> const &value)
+    constexpr auto getComplex(CUnit<UN> const &value)
     {
         using TY = decltype(value.real()());
         return std::complex<TY>{value.real()(), value.imag()()};
     }
 
     template <typename UN, typename TY>
-    CUnit<UN> setComplex(std::complex<TY> const &value)
+    constexpr CUnit<UN> setComplex(std::complex<TY> const &value)
     {
         UN re_value{value.real()};
         UN im_value{value.imag()};
         return CUnit<UN>{re_value, im_value};
     }
 
-    namespace /*Utilities*/
+    /// @cond
+    namespace utils
     {
+        /*
+         * Plain complex value used by compile-time expanded powers: unlike std::complex
+         * its product has no NaN recovery path, hence no library call. The members have
+         * default initializers, so `complex_value<TY>{1}` (the unit of ipow_value) is 1 + 0i
+         * without -Wmissing-field-initializers warnings.
+         */
+        template <typename TY>
+        struct complex_value
+        {
+            TY re_{};
+            TY im_{};
+        };
+
+        template <typename TY>
+        constexpr complex_value<TY> operator*(complex_value<TY> const &first, complex_value<TY> const &second)
+        {
+            return complex_value<TY>{first.re_ * second.re_ - first.im_ * second.im_,
+                                     first.re_ * second.im_ + second.re_ * first.im_};
+        }
+
+        template <typename TY>
+        constexpr complex_value<TY> operator/(complex_value<TY> const &numerator, complex_value<TY> const &denominator)
+        {
+            TY norm{denominator.re_ * denominator.re_ + denominator.im_ * denominator.im_};
+            return complex_value<TY>{(numerator.re_ * denominator.re_ + numerator.im_ * denominator.im_) / norm,
+                                     (denominator.re_ * numerator.im_ - numerator.re_ * denominator.im_) / norm};
+        }
+
+        /*
+         * Constexpr complex functions (see StrongUnitConstexprMath.h), evaluated in long double by the
+         * real ones; the inverse functions follow the formulas of the libstdc++ generic implementation.
+         */
+        using constexpr_complex = complex_value<long double>;
+
+        constexpr constexpr_complex constexpr_complex_exp(constexpr_complex z)
+        {
+            return (z.im_ == 0) ? constexpr_complex{constexpr_exp(z.re_), 0}
+                                : constexpr_complex{constexpr_exp(z.re_) * constexpr_cos(z.im_),
+                                                    constexpr_exp(z.re_) * constexpr_sin(z.im_)};
+        }
+
+        constexpr constexpr_complex constexpr_complex_log(constexpr_complex z)
+        {
+            return constexpr_complex{constexpr_log(constexpr_hypot(z.re_, z.im_)), constexpr_atan2(z.im_, z.re_)};
+        }
+
+        constexpr constexpr_complex constexpr_complex_log10(constexpr_complex z)
+        {
+            return constexpr_complex{constexpr_complex_log(z).re_ * constexpr_inv_ln10(),
+                                     constexpr_complex_log(z).im_ * constexpr_inv_ln10()};
+        }
+
+        /* Principal square root, t = sqrt((|re| + |z|) / 2) avoids the cancellation of |z| - |re| */
+        constexpr constexpr_complex constexpr_complex_sqrt(constexpr_complex z)
+        {
+            if (z.re_ == 0 && z.im_ == 0)
+            {
+                return constexpr_complex{0, z.im_};
+            }
+            long double const t{constexpr_sqrt((constexpr_abs(z.re_) + constexpr_hypot(z.re_, z.im_)) / 2)};
+            return (z.re_ >= 0) ? constexpr_complex{t, z.im_ / (2 * t)}
+                                : constexpr_complex{constexpr_abs(z.im_) / (2 * t), (z.im_ < 0) ? -t : t};
+        }
+
+        constexpr constexpr_complex constexpr_complex_sin(constexpr_complex z)
+        {
+            return constexpr_complex{constexpr_sin(z.re_) * constexpr_cosh(z.im_),
+                                     constexpr_cos(z.re_) * constexpr_sinh(z.im_)};
+        }
+
+        constexpr constexpr_complex constexpr_complex_cos(constexpr_complex z)
+        {
+            return constexpr_complex{constexpr_cos(z.re_) * constexpr_cosh(z.im_),
+                                     -constexpr_sin(z.re_) * constexpr_sinh(z.im_)};
+        }
+
+        constexpr constexpr_complex constexpr_complex_tan(constexpr_complex z)
+        {
+            return constexpr_complex_sin(z) / constexpr_complex_cos(z);
+        }
+
+        constexpr constexpr_complex constexpr_complex_sinh(constexpr_complex z)
+        {
+            return constexpr_complex{constexpr_sinh(z.re_) * constexpr_cos(z.im_),
+                                     constexpr_cosh(z.re_) * constexpr_sin(z.im_)};
+        }
+
+        constexpr constexpr_complex constexpr_complex_cosh(constexpr_complex z)
+        {
+            return constexpr_complex{constexpr_cosh(z.re_) * constexpr_cos(z.im_),
+                                     constexpr_sinh(z.re_) * constexpr_sin(z.im_)};
+        }
+
+        constexpr constexpr_complex constexpr_complex_tanh(constexpr_complex z)
+        {
+            return constexpr_complex_sinh(z) / constexpr_complex_cosh(z);
+        }
+
+        /* asinh(z) = log(z + sqrt(z^2 + 1)) */
+        constexpr constexpr_complex constexpr_complex_asinh(constexpr_complex z)
+        {
+            constexpr_complex const root{constexpr_complex_sqrt(
+                constexpr_complex{(z.re_ - z.im_) * (z.re_ + z.im_) + 1, 2 * z.re_ * z.im_})};
+            return constexpr_complex_log(constexpr_complex{z.re_ + root.re_, z.im_ + root.im_});
+        }
+
+        /* asin(z) = -i asinh(iz) */
+        constexpr constexpr_complex constexpr_complex_asin(constexpr_complex z)
+        {
+            return constexpr_complex{constexpr_complex_asinh(constexpr_complex{-z.im_, z.re_}).im_,
+                                     -constexpr_complex_asinh(constexpr_complex{-z.im_, z.re_}).re_};
+        }
+
+        /* acos(z) = π/2 - asin(z) */
+        constexpr constexpr_complex constexpr_complex_acos(constexpr_complex z)
+        {
+            return constexpr_complex{constexpr_pi() / 2 - constexpr_complex_asin(z).re_, -constexpr_complex_asin(z).im_};
+        }
+
+        constexpr constexpr_complex constexpr_complex_atan(constexpr_complex z)
+        {
+            long double const re2{z.re_ * z.re_};
+            long double const x{1 - re2 - z.im_ * z.im_};
+            long double const num{re2 + (z.im_ + 1) * (z.im_ + 1)};
+            long double const den{re2 + (z.im_ - 1) * (z.im_ - 1)};
+            return constexpr_complex{constexpr_atan2(2 * z.re_, x) / 2, constexpr_log(num / den) / 4};
+        }
+
+        /* acosh(z) = 2 log(sqrt((z + 1) / 2) + sqrt((z - 1) / 2)) */
+        constexpr constexpr_complex constexpr_complex_acosh(constexpr_complex z)
+        {
+            constexpr_complex const plus{constexpr_complex_sqrt(constexpr_complex{(z.re_ + 1) / 2, z.im_ / 2})};
+            constexpr_complex const minus{constexpr_complex_sqrt(constexpr_complex{(z.re_ - 1) / 2, z.im_ / 2})};
+            constexpr_complex const res{constexpr_complex_log(constexpr_complex{plus.re_ + minus.re_, plus.im_ + minus.im_})};
+            return constexpr_complex{2 * res.re_, 2 * res.im_};
+        }
+
+        constexpr constexpr_complex constexpr_complex_atanh(constexpr_complex z)
+        {
+            long double const im2{z.im_ * z.im_};
+            long double const x{1 - im2 - z.re_ * z.re_};
+            long double const num{im2 + (1 + z.re_) * (1 + z.re_)};
+            long double const den{im2 + (1 - z.re_) * (1 - z.re_)};
+            return constexpr_complex{(constexpr_log(num) - constexpr_log(den)) / 4, constexpr_atan2(2 * z.im_, x) / 2};
+        }
+
+        /* z^w = exp(w log(z)), zero for a zero base */
+        constexpr constexpr_complex constexpr_complex_pow(constexpr_complex z, constexpr_complex w)
+        {
+            return (z.re_ == 0 && z.im_ == 0)
+                       ? constexpr_complex{0, 0}
+                       : constexpr_complex_exp(constexpr_complex_log(z) * w);
+        }
+
+        /* z^y = polar(exp(y log|z|), y arg(z)), the real power of a positive real base */
+        constexpr constexpr_complex constexpr_complex_pow(constexpr_complex z, long double y)
+        {
+            return (z.im_ == 0 && z.re_ > 0)   ? constexpr_complex{constexpr_pow(z.re_, y), 0}
+                   : (z.re_ == 0 && z.im_ == 0) ? constexpr_complex{0, 0}
+                                                : constexpr_complex_exp(constexpr_complex{
+                                                      y * constexpr_complex_log(z).re_, y * constexpr_complex_log(z).im_});
+        }
+
+        template <typename TY>
+        constexpr constexpr_complex to_constexpr_complex(std::complex<TY> const &value)
+        {
+            return constexpr_complex{value.real(), value.imag()};
+        }
+
+        template <typename TY>
+        constexpr std::complex<TY> from_constexpr_complex(constexpr_complex const &value)
+        {
+            return std::complex<TY>{constexpr_narrow<TY>(value.re_), constexpr_narrow<TY>(value.im_)};
+        }
+
         template <typename TY>
         using complex_function = std::complex<TY> (*)(std::complex<TY> const &);
 
+        using constexpr_complex_function = constexpr_complex (*)(constexpr_complex);
+
+        /* It evaluates `ce_fun` in constant expressions, the <complex> function `c_fun` at run time */
+        template <typename TY>
+        constexpr std::complex<TY> complex_function_value(std::complex<TY> const &value,
+                                                          complex_function<TY> c_fun,
+                                                          constexpr_complex_function ce_fun)
+        {
+            return STU_CONSTANT_EVALUATED() ? from_constexpr_complex<TY>(ce_fun(to_constexpr_complex(value)))
+                                            : c_fun(value);
+        }
+
         template <typename TY, typename LA>
-        stu::numeral_cunity<TY> compute_complex_function(stu::numeral_cunity<TY, LA> const &value,
-                                                         complex_function<TY> c_fun)
+        constexpr stu::numeral_cunity<TY> compute_complex_function(stu::numeral_cunity<TY, LA> const &value,
+                                                                   complex_function<TY> c_fun,
+                                                                   constexpr_complex_function ce_fun)
         {
-            std::complex<TY> c{c_fun(getComplex(value))};
-            return setComplex<stu::numeral_unit<TY>>(c);
+            return setComplex<stu::numeral_unit<TY>>(complex_function_value(getComplex(value), c_fun, ce_fun));
         }
-    }
+
+        /* Principal den-th root of a complex value */
+        template <std::intmax_t den, typename TY>
+        constexpr std::complex<TY> complex_root(std::complex<TY> const &value)
+        {
+            if (den == 1)
+            {
+                return value;
+            }
+            if (STU_CONSTANT_EVALUATED())
+            {
+                return from_constexpr_complex<TY>((den == 2) ? constexpr_complex_sqrt(to_constexpr_complex(value))
+                                                             : constexpr_complex_pow(to_constexpr_complex(value), 1.0L / den));
+            }
+            return (den == 2) ? std::sqrt(value) : std::pow(value, TY{1} / den);
+        }
+    } // namespace utils
+    ///@endcond
 
     template <typename UN>
-    UN abs(CUnit<UN> const &value)
+    constexpr UN abs(CUnit<UN> const &value)
     {
-        return UN{std::abs(getComplex(value))};
+        return UN{utils::math::hypot(value.real()(), value.imag()())};
     }
 
     template <typename UN>
-    auto arg(CUnit<UN> const &value)
+    constexpr auto arg(CUnit<UN> const &value)
     {
         using TY = decltype(value.real()());
-        return stu::numeral_rad<TY, stu::tag::numeral_rad_label>{std::arg(getComplex(value))};
+        return stu::numeral_rad<TY, stu::tag::numeral_rad_label>{utils::math::atan2(value.imag()(), value.real()())};
     }
 
     template <typename UN, typename TY, typename LA>
-    CUnit<UN> polar(UN const &rho, stu::numeral_rad<TY, LA> const &theta)
+    constexpr CUnit<UN> polar(UN const &rho, stu::numeral_rad<TY, LA> const &theta)
     {
-        std::complex<TY> c{std::polar(rho(), theta())};
-        return setComplex<UN>(c);
+        return CUnit<UN>{UN{rho() * utils::math::cos(theta())}, UN{rho() * utils::math::sin(theta())}};
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> exp(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> exp(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::exp<TY>);
+        return utils::compute_complex_function(value, std::exp<TY>, utils::constexpr_complex_exp);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> log(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> log(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::log<TY>);
+        return utils::compute_complex_function(value, std::log<TY>, utils::constexpr_complex_log);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> log10(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> log10(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::log10<TY>);
+        return utils::compute_complex_function(value, std::log10<TY>, utils::constexpr_complex_log10);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> sin(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> sin(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::sin<TY>);
+        return utils::compute_complex_function(value, std::sin<TY>, utils::constexpr_complex_sin);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> cos(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> cos(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::cos<TY>);
+        return utils::compute_complex_function(value, std::cos<TY>, utils::constexpr_complex_cos);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> tan(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> tan(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::tan<TY>);
+        return utils::compute_complex_function(value, std::tan<TY>, utils::constexpr_complex_tan);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> asin(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> asin(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::asin<TY>);
+        return utils::compute_complex_function(value, std::asin<TY>, utils::constexpr_complex_asin);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> acos(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> acos(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::acos<TY>);
+        return utils::compute_complex_function(value, std::acos<TY>, utils::constexpr_complex_acos);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> atan(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> atan(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::atan<TY>);
+        return utils::compute_complex_function(value, std::atan<TY>, utils::constexpr_complex_atan);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> sinh(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> sinh(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::sinh<TY>);
+        return utils::compute_complex_function(value, std::sinh<TY>, utils::constexpr_complex_sinh);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> cosh(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> cosh(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::cosh<TY>);
+        return utils::compute_complex_function(value, std::cosh<TY>, utils::constexpr_complex_cosh);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> tanh(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> tanh(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::tanh<TY>);
+        return utils::compute_complex_function(value, std::tanh<TY>, utils::constexpr_complex_tanh);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> asinh(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> asinh(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::asinh<TY>);
+        return utils::compute_complex_function(value, std::asinh<TY>, utils::constexpr_complex_asinh);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> acosh(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> acosh(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::acosh<TY>);
+        return utils::compute_complex_function(value, std::acosh<TY>, utils::constexpr_complex_acosh);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> atanh(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> atanh(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::atanh<TY>);
+        return utils::compute_complex_function(value, std::atanh<TY>, utils::constexpr_complex_atanh);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> pow(stu::numeral_cunity<TY, LA> const &base,
-                                std::complex<long double> const &exponent)
+    constexpr stu::numeral_cunity<TY> pow(stu::numeral_cunity<TY, LA> const &base,
+                                          std::complex<long double> const &exponent)
     {
         auto c_exp = static_cast<std::complex<TY>>(exponent);
-        std::complex<TY> c{std::pow(getComplex(base), c_exp)};
+        std::complex<TY> c{STU_CONSTANT_EVALUATED()
+                               ? utils::from_constexpr_complex<TY>(utils::constexpr_complex_pow(
+                                     utils::to_constexpr_complex(getComplex(base)), utils::to_constexpr_complex(c_exp)))
+                               : std::pow(getComplex(base), c_exp)};
         return setComplex<stu::numeral_unit<TY>>(c);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> pow(stu::numeral_cunity<TY, LA> const &base,
-                                stu::numeral_cunity<TY, LA> const &exponent)
+    constexpr stu::numeral_cunity<TY> pow(stu::numeral_cunity<TY, LA> const &base,
+                                          stu::numeral_cunity<TY, LA> const &exponent)
     {
         return stu::pow(base, getComplex(exponent));
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> pow(stu::numeral_cunity<TY, LA> const &base,
-                                long double const &exponent)
+    constexpr stu::numeral_cunity<TY> pow(stu::numeral_cunity<TY, LA> const &base,
+                                          long double const &exponent)
     {
         auto ty_exp = static_cast<TY>(exponent);
-        std::complex<TY> c{std::pow(getComplex(base), ty_exp)};
+        std::complex<TY> c{STU_CONSTANT_EVALUATED()
+                               ? utils::from_constexpr_complex<TY>(utils::constexpr_complex_pow(
+                                     utils::to_constexpr_complex(getComplex(base)), static_cast<long double>(ty_exp)))
+                               : std::pow(getComplex(base), ty_exp)};
         return setComplex<stu::numeral_unit<TY>>(c);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> pow(stu::numeral_cunity<TY, LA> const &base,
-                                stu::numeral_unit<TY, LA> const &exponent)
+    constexpr stu::numeral_cunity<TY> pow(stu::numeral_cunity<TY, LA> const &base,
+                                          stu::numeral_unit<TY, LA> const &exponent)
     {
         return stu::pow(base, exponent());
     }
 
     template <std::intmax_t exponent, typename UN>
-    auto pow(CUnit<UN> const &base)
+    constexpr auto pow(CUnit<UN> const &base)
     {
         using TY = decltype(base.real()());
         using unnamed_unit = decltype(stu::pow<exponent>(base.real()));
-        std::complex<TY> c{std::pow(getComplex(base), static_cast<long double>(exponent))};
+        utils::complex_value<TY> c{utils::ipow_value<exponent>::apply(
+            utils::complex_value<TY>{base.real()(), base.imag()()})};
 
-        return setComplex<unnamed_unit>(c);
+        return CUnit<unnamed_unit>{unnamed_unit{c.re_}, unnamed_unit{c.im_}};
+    }
+
+    /**
+     * @brief It computes the principal value of the rational power `base^(num/den)` of a complex unit.
+     */
+    template <std::intmax_t num, std::intmax_t den, typename UN>
+    constexpr auto pow(CUnit<UN> const &base)
+    {
+        using TY = decltype(base.real()());
+        using exponent = typename std::ratio<num, den>::type;
+        using unnamed_unit = decltype(stu::pow<exponent::num, exponent::den>(base.real()));
+        std::complex<TY> root{utils::complex_root<exponent::den>(getComplex(base))};
+        utils::complex_value<TY> c{utils::ipow_value<exponent::num>::apply(
+            utils::complex_value<TY>{root.real(), root.imag()})};
+
+        return CUnit<unnamed_unit>{unnamed_unit{c.re_}, unnamed_unit{c.im_}};
+    }
+
+    template <std::intmax_t degree, typename UN>
+    constexpr auto root(CUnit<UN> const &value)
+    {
+        return stu::pow<1, degree>(value);
+    }
+
+    template <typename UN>
+    constexpr auto cbrt(CUnit<UN> const &value)
+    {
+        return stu::pow<1, 3>(value);
     }
 
     template <typename TY, typename LA>
-    stu::numeral_cunity<TY> sqrt(stu::numeral_cunity<TY, LA> const &value)
+    constexpr stu::numeral_cunity<TY> sqrt(stu::numeral_cunity<TY, LA> const &value)
     {
-        return compute_complex_function(value, std::sqrt<TY>);
+        return utils::compute_complex_function(value, std::sqrt<TY>, utils::constexpr_complex_sqrt);
     }
 
     template <typename UN>
-    auto sqrt(CUnit<UN> const &value)
+    constexpr auto sqrt(CUnit<UN> const &value)
     {
-        using TY = decltype(value.real()());
         using unnamed_unit = decltype(stu::sqrt(value.real()));
-        std::complex<TY> c{std::sqrt(getComplex(value))};
-
-        return setComplex<unnamed_unit>(c);
+        return setComplex<unnamed_unit>(utils::complex_root<2>(getComplex(value)));
     }
 
     namespace constants
     {
 #ifdef STU_UNIT_TYPE
-        static constexpr const cunit j{_0, _1};
+        STU_DEF_SYMBOL(cunit, j, _0, _1)
 #endif
     } // namespace constants
 
@@ -0,0 +1,78 @@
+/**
+ * @file StrongCUnitIO.h
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Complex Strong Unit iostream support (printing and streaming)
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STRONGCOMPLEXUNITIO_H
+#define STRONGCOMPLEXUNITIO_H
+
+#include "StrongCUnit.h"
+#include "StrongUnitIO.h"
+
+namespace stu
+{
+    /**
+     * @brief It streams out the value of a complex unit.
+     */
+    template <typename UN>
+    std::ostream &operator<<(std::ostream &os, CUnit<UN> const &a_cunit)
+    {
+        if (a_cunit.imag()() >= 0)
+            os << a_cunit.real() << "+j" << a_cunit.imag();
+        else
+            os << a_cunit.real() << "-j" << -1.0 * a_cunit.imag();
+        return os;
+    }
+
+    /**
+     * @brief It streams in real and imaginary numeric values to a complex unit.
+     */
+    template <typename UN>
+    std::istream &operator>>(std::istream &is, CUnit<UN> &a_cunit)
+    {
+        UN real{};
+        UN imag{};
+        if (is >> real >> imag)
+            a_cunit = CUnit<UN>{real, imag};
+        return is;
+    }
+
+    /**
+     * @brief Prints real and imaginary parts information to the standard output.
+     */
+    template <typename UN>
+    void print_unit(CUnit<UN> const &a_cunit)
+    {
+        std::cout << "Re: ";
+        a_cunit.real().print();
+        std::cout << "Im: ";
+        a_cunit.imag().print();
+    }
+
+} // namespace stu
+
+#endif // STRONGCOMPLEXUNITIO_H
@@ -39,4 +39,37 @@
 #define STU_UNIT_TYPE double
 #endif
 
+/**
+ * @brief
+ * Defining `STU_EXPLICIT_CONVERSIONS` (e.g. `-DSTU_EXPLICIT_CONVERSIONS` for performance-critical targets) selects
+ * the explicit conversion policy: a unit converts to another scale of its quantity only by `stu::unit_cast<TO>(value)`
+ * (or `static_cast`), and `+`, `-`, `%`, comparisons, `min` and `max` of units having different scales fail to compile.
+ * Conversions between units of the same scale (alias units) stay implicit. Otherwise all the conversions are implicit.
+ * @note The policy does not change the generated code, but it changes the declarations of the conversions
+ *       (`explicit` or not): it must be defined or not defined consistently in all the translation units of a
+ *       program, libraries included, otherwise the unit classes violate the one definition rule.
+ */
+
+/**
+ * @brief
+ * Defining `STU_CONVERSION_AUDIT` (e.g. `-DSTU_CONVERSION_AUDIT`) enables the conversion audit mode:
+ * every implicit conversion between two scales of a quantity, including the ones inside `operator+`,
+ * `operator-`, comparisons, `min` and `max`, is counted by a thread-local counter per quantity and pair
+ * of scales, and a report, most frequent first, is printed to the standard error at exit (`StrongUnitAudit.h`).
+ * @note When it is not defined the audit code is not compiled at all. It must be defined or not defined
+ *       consistently in all the translation units of a program.
+ */
+
+/**
+ * @brief
+ * Defining `STU_CHECKED_ARITHMETIC` (e.g. `-DSTU_CHECKED_ARITHMETIC` for debug and test targets) selects the checked
+ * numeric policy: constructing a unit, including the results of `*`, `/`, `+` and `-`, and the compound operators
+ * throw `stu::arithmetic_error`, naming the operation and the unit label, when the value is NaN or infinite.
+ * Otherwise (fast policy) values are stored unchecked and scalar operations stay in the wrapped type, so loops
+ * vectorize and fast-math friendly builds keep their transformations.
+ * @note The checked policy relies on IEEE arithmetic: it must not be combined with `-ffinite-math-only`
+ *       (or `-ffast-math`), which lets the compiler drop the checks. Like the conversion policy, it is a
+ *       whole-program setting.
+ */
+
 #endif // STRONGTYPEDEFINITION_H
\ No newline at end of file
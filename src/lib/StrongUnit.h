@@ -30,16 +30,15 @@
 #ifndef STRONGUNIT_H
 #define STRONGUNIT_H
 
-/**
- * @brief
- * It enables iostream support for strong units
- */
-
 #include <type_traits>
 #include <ratio>
 #include <cmath>
+#include <utility>
+#include "StrongUnitConstexprMath.h"
+#ifdef STU_CHECKED_ARITHMETIC
+#include <stdexcept>
 #include <string>
-#include <iostream>
+#endif
 
 /**
  * @brief
@@ -70,13 +69,75 @@ namespace stu
     namespace prefixes
     {
     }
+
+    /**
+     * @brief
+     * Namespace in which prefixed strong unit literals are defined, e.g. "1.0_km" or "5_ms".
+     */
+    namespace prefixed_literals
+    {
+    }
 } // namespace std
 
 /**
  * @brief
- * Defines a rational `scale=up/dn` used for unit linear conversion.
+ * Defines a strong unit symbol, prefix or constant having a single definition across the program.
+ * @note it is an inline variable since C++17 (and in the `stu` module), otherwise a reference to
+ *       the static member of a class template, whose definition is merged by the linker.
+ */
+#if defined(STU_MODULE) || defined(__cpp_inline_variables)
+#define STU_DEF_SYMBOL(a_type, name, ...) \
+    inline constexpr a_type name{__VA_ARGS__};
+#else
+#define STU_DEF_SYMBOL(a_type, name, ...)                \
+    namespace symbol_storage                             \
+    {                                                    \
+        template <typename = void>                       \
+        struct name##_                                   \
+        {                                                \
+            static constexpr a_type value_{__VA_ARGS__}; \
+        };                                               \
+        template <typename T>                            \
+        constexpr a_type name##_<T>::value_;             \
+    }                                                    \
+    static constexpr a_type const &name = symbol_storage::name##_<>::value_;
+#endif
+
+/**
+ * @brief
+ * Numeric policy (see StrongTypeDefinition.h): with `STU_CHECKED_ARITHMETIC` every value stored by a unit
+ * is checked to be finite, otherwise the value is stored as it is.
+ * `STU_NOEXCEPT_UNCHECKED` is the exception specification of the functions building units outside `Unit`:
+ * `noexcept` unless the checked policy makes them throw.
+ */
+#ifdef STU_CHECKED_ARITHMETIC
+#define STU_CHECKED(label, value, operation) stu::utils::check_finite<label>(value, operation)
+#define STU_NOEXCEPT_UNCHECKED
+#else
+#define STU_CHECKED(label, value, operation) (value)
+#define STU_NOEXCEPT_UNCHECKED noexcept
+#endif
+
+/**
+ * @brief
+ * Conversion policy (see StrongTypeDefinition.h): with `STU_EXPLICIT_CONVERSIONS` the conversions between
+ * different scales are `explicit` and mixed-scale operations fail to compile, otherwise both are implicit.
+ * @note It changes the class definitions, so all the translation units of a program must agree on it (ODR).
+ */
+#ifdef STU_EXPLICIT_CONVERSIONS
+#define STU_CONVERSION_SPECIFIER explicit
+#define STU_ASSERT_NO_CONVERSION(from, ...) \
+    static_assert(std::is_same<from, __VA_ARGS__>::value, "==>> MIXED SCALES REQUIRE AN EXPLICIT stu::unit_cast! <<==")
+#else
+#define STU_CONVERSION_SPECIFIER
+#define STU_ASSERT_NO_CONVERSION(from, ...)
+#endif
+
+/**
+ * @brief
+ * Defines a `scale=(up/dn)*π^pi` used for unit linear conversion.
  * @note it should be called before DEF_UNIT.
- * @note down default value (`dn=1`).
+ * @note down default value (`dn=1`), π exponent default value (`pi=0`).
  */
 #define DEF_SCALE(scale, up, ...) \
     using scale = stu::Scale<up, ##__VA_ARGS__>;
@@ -89,49 +150,114 @@ namespace stu
 #define DEF_QUANTITY(quantity, ...) \
     using quantity = stu::Quantity<__VA_ARGS__>;
 
+/**
+ * @brief
+ * Defines the label of the base quantity `index` (0-9) printed by unnamed derived units.
+ * @note default labels are `b0`, `b1`, ..., `b9`.
+ */
+#define DEF_BASE_LABEL(index, label)                               \
+    namespace tag                                                  \
+    {                                                              \
+        template <>                                                \
+        struct base_label<index>                                   \
+        {                                                          \
+            static constexpr char const *name() { return #label; } \
+        };                                                         \
+    }
+
 /**
  * @brief
  * Defines a strong unit prefix.
  */
-#define DEF_PREFIX(quantity, a_unit, type, label, scale)         \
-    namespace tag                                                \
-    {                                                            \
-        struct label                                             \
-        {                                                        \
-            label(){};                                           \
-            std::string label_{#label};                          \
-        };                                                       \
-    }                                                            \
-    using a_unit = stu::Unit<type, quantity, scale, tag::label>; \
-    namespace prefixes                                           \
-    {                                                            \
-        static constexpr a_unit label{1};                        \
+#define DEF_PREFIX(quantity, a_unit, type, label, scale)           \
+    namespace tag                                                  \
+    {                                                              \
+        struct label                                               \
+        {                                                          \
+            static constexpr char const *name() { return #label; } \
+        };                                                         \
+    }                                                              \
+    using a_unit = stu::Unit<type, quantity, scale, tag::label>;   \
+    namespace prefixes                                             \
+    {                                                              \
+        STU_DEF_SYMBOL(a_unit, label, 1)                           \
     }
 
 /**
  * @brief
  * Defines a strong unit.
  */
-#define DEF_UNIT(quantity, a_unit, type, label, scale)           \
-    namespace tag                                                \
-    {                                                            \
-        struct label                                             \
-        {                                                        \
-            label(){};                                           \
-            std::string label_{#label};                          \
-        };                                                       \
-    }                                                            \
-    using a_unit = stu::Unit<type, quantity, scale, tag::label>; \
-    namespace literals                                           \
-    {                                                            \
-        a_unit operator"" label(long double val)                 \
-        {                                                        \
-            return a_unit{static_cast<type>(val)};               \
-        }                                                        \
-    }                                                            \
-    namespace symbols                                            \
-    {                                                            \
-        static constexpr a_unit label{1};                        \
+#define DEF_UNIT(a_quantity, a_unit, a_type, label, a_scale)           \
+    namespace tag                                                      \
+    {                                                                  \
+        struct label                                                   \
+        {                                                              \
+            static constexpr char const *name() { return #label; }     \
+        };                                                             \
+    }                                                                  \
+    using a_unit = stu::Unit<a_type, a_quantity, a_scale, tag::label>; \
+    namespace literals                                                 \
+    {                                                                  \
+        constexpr a_unit operator"" label(long double val)             \
+        {                                                              \
+            return a_unit{static_cast<a_type>(val)};                   \
+        }                                                              \
+        constexpr a_unit operator"" label(unsigned long long val)      \
+        {                                                              \
+            return a_unit{static_cast<a_type>(val)};                   \
+        }                                                              \
+    }                                                                  \
+    namespace symbols                                                  \
+    {                                                                  \
+        STU_DEF_SYMBOL(a_unit, label, 1)                               \
+    }
+
+/**
+ * @brief
+ * Defines a strong unit and registers it as the named result of derived unit operations, i.e. products,
+ * quotients and powers yielding its type, quantity and scale return this unit (e.g. volt / ampere is ohm).
+ * @note it must be called in the `stu` namespace, and at most once for a type, quantity and scale
+ *       (other units of the same type, quantity and scale are defined by DEF_UNIT).
+ */
+#define DEF_NAMED_UNIT(a_quantity, a_unit, a_type, label, a_scale)       \
+    DEF_UNIT(a_quantity, a_unit, a_type, label, a_scale)                 \
+    namespace utils                                                      \
+    {                                                                    \
+        template <>                                                      \
+        struct named_unit<a_unit::type, a_unit::quantity, a_unit::scale> \
+        {                                                                \
+            using type = a_unit;                                         \
+        };                                                               \
+    }
+
+/**
+ * @brief
+ * Defines a prefixed literal `_<prefix><symbol>` of a strong unit, e.g. `_km` from `meter`, `k` and `m`.
+ * @note the literal scale is the product of the unit scale and the prefix scale.
+ */
+#define DEF_PREFIXED_LITERAL(a_unit, symbol, prefix, prefix_scale)                              \
+    namespace tag                                                                               \
+    {                                                                                           \
+        namespace prefixed                                                                      \
+        {                                                                                       \
+            struct _##prefix##symbol                                                            \
+            {                                                                                   \
+                static constexpr char const *name() { return "_" #prefix #symbol; }             \
+            };                                                                                  \
+        }                                                                                       \
+    }                                                                                           \
+    namespace prefixed_literals                                                                 \
+    {                                                                                           \
+        constexpr auto operator"" _##prefix##symbol(long double val)                            \
+        {                                                                                       \
+            return stu::Unit<a_unit::type, a_unit::quantity,                                    \
+                             stu::utils::mul_scales_t<a_unit::scale, prefix_scale>,             \
+                             tag::prefixed::_##prefix##symbol>{static_cast<a_unit::type>(val)}; \
+        }                                                                                       \
+        constexpr auto operator"" _##prefix##symbol(unsigned long long val)                     \
+        {                                                                                       \
+            return operator"" _##prefix##symbol(static_cast<long double>(val));                 \
+        }                                                                                       \
     }
 
 namespace stu
@@ -139,43 +265,63 @@ namespace stu
     /// @cond
     namespace utils /* Utilities to compute derived quantities */
     {
-        template <std::uintmax_t a, std::uintmax_t b>
-        struct mcd
+        constexpr std::uintmax_t mcd(std::uintmax_t a, std::uintmax_t b)
         {
-            static constexpr std::uintmax_t value = mcd<b, a % b>::value;
-        };
-        template <std::uintmax_t a>
-        struct mcd<a, 0>
-        {
-            static constexpr std::uintmax_t value = a;
-        };
+            return (b == 0) ? a : mcd(b, a % b);
+        }
 
         /**
          * Scale
-         * Struct template representing a rational scale for unit linear conversion.
+         * Struct template representing the scale (UP/DN)*π^PI for unit linear conversion.
+         * The π power is symbolic, so angle scales are exact and scales with the same π power
+         * convert through the rational part only.
          *
          * tparam UP scale numerator
          * tparam DN scale denominator
+         * tparam PI scale π exponent
          */
-        template <std::uintmax_t UP, std::uintmax_t DN>
+        template <std::uintmax_t UP, std::uintmax_t DN, std::intmax_t PI = 0>
         struct ScaleBase
         {
             static_assert((UP > 0 && UP <= UINTMAX_MAX), "==>> INVALID SCALE UP! <<==");
             static_assert((DN > 0 && DN <= UINTMAX_MAX), "==>> INVALID SCALE DN! <<==");
             static constexpr std::uintmax_t up_ = UP;
             static constexpr std::uintmax_t dn_ = DN;
+            static constexpr std::intmax_t pi_ = PI;
         };
 
-        template <std::uintmax_t UP, std::uintmax_t DN>
+        template <std::uintmax_t UP, std::uintmax_t DN, std::intmax_t PI>
         struct simplified_scale
         {
-            using type = ScaleBase<UP / mcd<UP, DN>::value, DN / mcd<UP, DN>::value>;
+            using type = ScaleBase<UP / mcd(UP, DN), DN / mcd(UP, DN), PI>;
         };
+
+        /*
+         * π^exponent in long double precision, it is evaluated at compile time.
+         */
+        constexpr long double pi_power(std::intmax_t exponent)
+        {
+            long double res{1.0L};
+            for (; exponent > 0; --exponent)
+                res *= 3.141592653589793238462643383279502884L;
+            for (; exponent < 0; ++exponent)
+                res /= 3.141592653589793238462643383279502884L;
+            return res;
+        }
+
+        /*
+         * Value of a scale in long double precision, it is evaluated at compile time.
+         */
+        template <typename SC>
+        constexpr long double scale_value()
+        {
+            return 1.0L * SC::up_ / SC::dn_ * pi_power(SC::pi_);
+        }
     } // namespace utils
     ///@endcond
 
-    template <std::uintmax_t UP, std::uintmax_t DN = 1>
-    using Scale = typename utils::simplified_scale<UP, DN>::type;
+    template <std::uintmax_t UP, std::uintmax_t DN = 1, std::intmax_t PI = 0>
+    using Scale = typename utils::simplified_scale<UP, DN, PI>::type;
 
     /**
      * @brief
@@ -198,28 +344,63 @@ namespace stu
     /* Add here more ratios if needed*/
     struct Quantity
     {
-        static constexpr BASE0EXP b0e{};
-        static constexpr BASE1EXP b1e{};
-        static constexpr BASE2EXP b2e{};
-        static constexpr BASE3EXP b3e{};
-        static constexpr BASE4EXP b4e{};
-        static constexpr BASE5EXP b5e{};
-        static constexpr BASE6EXP b6e{};
-        static constexpr BASE7EXP b7e{};
-        static constexpr BASE8EXP b8e{};
-        static constexpr BASE9EXP b9e{};
+        using b0e = BASE0EXP;
+        using b1e = BASE1EXP;
+        using b2e = BASE2EXP;
+        using b3e = BASE3EXP;
+        using b4e = BASE4EXP;
+        using b5e = BASE5EXP;
+        using b6e = BASE6EXP;
+        using b7e = BASE7EXP;
+        using b8e = BASE8EXP;
+        using b9e = BASE9EXP;
         /* Add here more ratios if needed*/
     };
 
     /// @cond
     namespace utils /* Utilities to compute derived quantities */
     {
+        /*
+         * Lightweight exponent arithmetic: most quantity exponents are zero, in that case
+         * the other operand is forwarded without instantiating any std::ratio arithmetic.
+         */
+        template <class BE1, class BE2, bool = (BE1::num == 0), bool = (BE2::num == 0)>
+        struct add_exponents
+        {
+            using type = typename std::ratio<BE1::num * BE2::den + BE2::num * BE1::den,
+                                             BE1::den * BE2::den>::type;
+        };
+        template <class BE1, class BE2, bool ZERO1>
+        struct add_exponents<BE1, BE2, ZERO1, true>
+        {
+            using type = BE1;
+        };
+        template <class BE1, class BE2>
+        struct add_exponents<BE1, BE2, true, false>
+        {
+            using type = BE2;
+        };
+
+        template <class BE1, class BE2>
+        using sub_exponents = add_exponents<BE1, std::ratio<-BE2::num, BE2::den>>;
+
+        template <class BE, class EXP, bool = (BE::num == 0)>
+        struct mul_exponents
+        {
+            using type = typename std::ratio<BE::num * EXP::num, BE::den * EXP::den>::type;
+        };
+        template <class BE, class EXP>
+        struct mul_exponents<BE, EXP, true>
+        {
+            using type = BE;
+        };
+
         template <class, class>
         struct mul_quantities;
         template <class... BEs1, class... BEs2>
         struct mul_quantities<Quantity<BEs1...>, Quantity<BEs2...>>
         {
-            using type_quantity = Quantity<std::ratio_add<BEs1, BEs2>...>;
+            using type_quantity = Quantity<typename add_exponents<BEs1, BEs2>::type...>;
         };
         template <class QU1, class QU2>
         using mul_quantities_t = typename mul_quantities<QU1, QU2>::type_quantity;
@@ -229,7 +410,7 @@ namespace stu
         template <class... BEs1, class... BEs2>
         struct div_quantities<Quantity<BEs1...>, Quantity<BEs2...>>
         {
-            using type_quantity = Quantity<std::ratio_subtract<BEs1, BEs2>...>;
+            using type_quantity = Quantity<typename sub_exponents<BEs1, BEs2>::type...>;
         };
         template <class QU1, class QU2>
         using div_quantities_t = typename div_quantities<QU1, QU2>::type_quantity;
@@ -239,32 +420,299 @@ namespace stu
         template <class... BEs1, class EXP>
         struct pow_quantities<Quantity<BEs1...>, EXP>
         {
-            using type_quantity = Quantity<std::ratio_multiply<BEs1, EXP>...>;
+            using type_quantity = Quantity<typename mul_exponents<BEs1, EXP>::type...>;
         };
         template <class QU1, class QU2>
         using pow_quantities_t = typename pow_quantities<QU1, QU2>::type_quantity;
 
-        constexpr std::uintmax_t isqrt(std::uintmax_t value)
+        constexpr std::uintmax_t ipow(std::uintmax_t base, std::intmax_t exponent)
+        {
+            if (exponent > 0)
+                return (base * ipow(base, exponent - 1));
+            else
+                return 1UL;
+        }
+
+        /*
+         * It checks whether base^exponent > limit without overflowing.
+         */
+        constexpr bool ipow_exceeds(std::uintmax_t base, std::intmax_t exponent, std::uintmax_t limit)
+        {
+            std::uintmax_t res{1};
+            for (std::intmax_t i{0}; i < exponent; ++i)
+            {
+                if (base != 0 && res > limit / base)
+                    return true;
+                res *= base;
+            }
+            return (res > limit);
+        }
+
+        /*
+         * Integer n-th root computed by binary search in O(log(value)) steps.
+         * It returns 0 if value is not a perfect n-th power.
+         */
+        constexpr std::uintmax_t iroot(std::uintmax_t value, std::intmax_t degree)
         {
-            for (std::uintmax_t i{1}; i <= (value + 1) / 2; ++i)
+            std::uintmax_t low{1};
+            std::uintmax_t high{value};
+            while (degree > 0 && low <= high)
             {
-                if ((value % i == 0) && (i * i == value))
-                    return i;
+                std::uintmax_t mid{low + (high - low) / 2};
+                if (ipow_exceeds(mid, degree, value))
+                    high = mid - 1;
+                else if (ipow(mid, degree) < value)
+                    low = mid + 1;
+                else
+                    return mid;
             }
             return 0;
         }
 
-        constexpr std::uintmax_t ipow(std::uintmax_t base, std::intmax_t exponent)
+        constexpr std::uintmax_t isqrt(std::uintmax_t value)
         {
-            if (exponent > 0)
-                return (base * ipow(base, exponent - 1));
-            else
-                return 1UL;
+            return iroot(value, 2);
         }
 
+        /*
+         * Integer power of a value expanded at compile time by exponentiation by squaring,
+         * e.g. x^5 = ((x*x)*(x*x))*x. Negative exponents compute the reciprocal of the positive power.
+         * TY only needs to provide `TY{1}`, `operator*` and `operator/`.
+         */
+        template <std::intmax_t exponent, bool = (exponent < 0)>
+        struct ipow_value
+        {
+            template <typename TY>
+            static constexpr TY apply(TY const &base)
+            {
+                TY half{ipow_value<exponent / 2>::apply(base)};
+                return (exponent % 2 == 0) ? (half * half) : (half * half * base);
+            }
+        };
+        template <>
+        struct ipow_value<0, false>
+        {
+            template <typename TY>
+            static constexpr TY apply(TY const &)
+            {
+                return TY{1};
+            }
+        };
+        template <>
+        struct ipow_value<1, false>
+        {
+            template <typename TY>
+            static constexpr TY apply(TY const &base)
+            {
+                return base;
+            }
+        };
+        template <std::intmax_t exponent>
+        struct ipow_value<exponent, true>
+        {
+            template <typename TY>
+            static constexpr TY apply(TY const &base)
+            {
+                return TY{1} / ipow_value<0 - exponent>::apply(base);
+            }
+        };
+
+        /*
+         * Rational power (num/den) of a value: x^(num/den) = (x^q)*(root(x)^r) where num = q*den + r,
+         * using sqrt and cbrt kernels for square and cubic roots. The odd roots of negative values are negative
+         * (pow of the magnitude), the even ones are NaN. Negative exponents compute the reciprocal (e.g. 1/sqrt(x)
+         * for -1/2).
+         */
+        template <std::intmax_t num, std::intmax_t den>
+        struct rpow_value
+        {
+            static constexpr std::intmax_t abs_num_ = (num >= 0) ? num : 0 - num;
+
+            template <typename TY>
+            static constexpr TY root(TY const &base, std::integral_constant<std::intmax_t, 2>)
+            {
+                return math::sqrt(base);
+            }
+
+            template <typename TY>
+            static constexpr TY root(TY const &base, std::integral_constant<std::intmax_t, 3>)
+            {
+                return math::cbrt(base);
+            }
+
+            template <typename TY, std::intmax_t degree>
+            static constexpr TY root(TY const &base, std::integral_constant<std::intmax_t, degree>)
+            {
+                return (degree % 2 != 0 && base < 0) ? -math::pow(-base, TY{1} / degree)
+                                                     : math::pow(base, TY{1} / degree);
+            }
+
+            template <typename TY>
+            static constexpr TY apply(TY const &base)
+            {
+                TY res{ipow_value<abs_num_ / den>::apply(base) *
+                       ipow_value<abs_num_ % den>::apply(root(base, std::integral_constant<std::intmax_t, den>{}))};
+                return (num >= 0) ? res : TY{1} / res;
+            }
+        };
+        template <std::intmax_t num>
+        struct rpow_value<num, 1> : ipow_value<num>
+        {
+        };
+
+        constexpr bool mul_overflows(std::uintmax_t a, std::uintmax_t b)
+        {
+            return (a != 0 && b > UINTMAX_MAX / a);
+        }
+
+        /*
+         * Product of two simplified scales (UP1/DN1)*(UP2/DN2).
+         * Numerators and denominators are cross-simplified before being multiplied,
+         * so the result is already simplified and it overflows only if the exact scale
+         * cannot be represented.
+         */
+        template <std::uintmax_t UP1, std::uintmax_t DN1, std::uintmax_t UP2, std::uintmax_t DN2, std::intmax_t PI>
+        struct mul_scales
+        {
+            static constexpr std::uintmax_t up1_ = UP1 / mcd(UP1, DN2);
+            static constexpr std::uintmax_t dn2_ = DN2 / mcd(UP1, DN2);
+            static constexpr std::uintmax_t up2_ = UP2 / mcd(UP2, DN1);
+            static constexpr std::uintmax_t dn1_ = DN1 / mcd(UP2, DN1);
+            static_assert(!mul_overflows(up1_, up2_) && !mul_overflows(dn1_, dn2_),
+                          "==>> SCALE OVERFLOW! <<==");
+
+            using type = ScaleBase<up1_ * up2_, dn1_ * dn2_, PI>;
+        };
+
+        template <class SC1, class SC2>
+        using mul_scales_t = typename mul_scales<SC1::up_, SC1::dn_, SC2::up_, SC2::dn_, SC1::pi_ + SC2::pi_>::type;
+
+        template <class SC1, class SC2>
+        using div_scales_t = typename mul_scales<SC1::up_, SC1::dn_, SC2::dn_, SC2::up_, SC1::pi_ - SC2::pi_>::type;
+
+        /*
+         * Integer power of a simplified scale, the result is simplified as well.
+         */
+        template <std::uintmax_t UP, std::uintmax_t DN, std::intmax_t PI, std::intmax_t exponent>
+        struct pow_scales
+        {
+            static constexpr std::intmax_t abs_exponent_ = (exponent >= 0) ? exponent : 0 - exponent;
+            static_assert(!ipow_exceeds(UP, abs_exponent_, UINTMAX_MAX) &&
+                              !ipow_exceeds(DN, abs_exponent_, UINTMAX_MAX),
+                          "==>> SCALE OVERFLOW! <<==");
+
+            using type = std::conditional_t<(exponent >= 0),
+                                            ScaleBase<ipow(UP, abs_exponent_), ipow(DN, abs_exponent_), PI * exponent>,
+                                            ScaleBase<ipow(DN, abs_exponent_), ipow(UP, abs_exponent_), PI * exponent>>;
+        };
+
+        template <class SC, std::intmax_t exponent>
+        using pow_scales_t = typename pow_scales<SC::up_, SC::dn_, SC::pi_, exponent>::type;
+
+        /*
+         * Rational power (num/den) of a simplified scale: the exact den-th root is computed first,
+         * then it is raised to num. The π exponent must be divisible by den.
+         */
+        template <std::uintmax_t UP, std::uintmax_t DN, std::intmax_t PI, std::intmax_t num, std::intmax_t den>
+        struct rpow_scales
+        {
+            static_assert(den > 0, "==>> INVALID EXPONENT! <<==");
+            static constexpr std::uintmax_t up_ = iroot(UP, den);
+            static constexpr std::uintmax_t dn_ = iroot(DN, den);
+            static_assert(up_ > 0 && dn_ > 0 && PI % den == 0, "==>> INVALID SCALE! <<==");
+
+            using type = typename pow_scales<up_, dn_, PI / den, num>::type;
+        };
+
+        template <class SC, std::intmax_t num, std::intmax_t den>
+        using rpow_scales_t = typename rpow_scales<SC::up_, SC::dn_, SC::pi_, num, den>::type;
+
+        /*
+         * Linear conversion of a value from the scale SC1 to SC2.
+         * Scales with the same π power convert through their rational parts, otherwise the
+         * conversion is a single multiply by the factor SC1/SC2 rounded once at compile time.
+         */
+        template <typename TY, typename SC1, typename SC2, bool = (SC1::pi_ == SC2::pi_)>
+        struct scale_conversion
+        {
+            static constexpr TY apply(TY value)
+            {
+                return static_cast<TY>(1.0 * value * SC1::up_ / SC1::dn_ * SC2::dn_ / SC2::up_);
+            }
+        };
+
+        template <typename TY, typename SC1, typename SC2>
+        struct scale_conversion<TY, SC1, SC2, false>
+        {
+            static constexpr TY factor_ = static_cast<TY>(scale_value<div_scales_t<SC1, SC2>>());
+
+            static constexpr TY apply(TY value)
+            {
+                return value * factor_;
+            }
+        };
+
     } // namespace utils
     ///@endcond
 
+#ifdef STU_CONVERSION_AUDIT
+    /// @cond
+    namespace utils
+    {
+        /* Counter of the scale conversions from SC1 to SC2 of the quantity QU, see StrongUnitAudit.h */
+        template <typename QU, typename SC1, typename SC2>
+        struct conversion_audit;
+    } // namespace utils
+    ///@endcond
+#endif
+
+#ifdef STU_CHECKED_ARITHMETIC
+    /**
+     * @brief
+     * Exception thrown by the checked numeric policy when a unit operation yields NaN or an infinity.
+     */
+    class arithmetic_error final : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /// @cond
+    namespace utils /* Checked numeric policy */
+    {
+        template <typename LABEL, typename = void>
+        struct label_name
+        {
+            static constexpr char const *name() { return "(derived unit)"; }
+        };
+
+        template <typename LABEL>
+        struct label_name<LABEL, decltype(static_cast<void>(LABEL::name()))>
+        {
+            static constexpr char const *name() { return LABEL::name(); }
+        };
+
+        template <typename LABEL, typename TY>
+        [[noreturn]] void throw_arithmetic_error(TY value, char const *operation)
+        {
+            char const *const kind = (value != value) ? "NaN" : ((value > 0) ? "+inf" : "-inf");
+            throw arithmetic_error{std::string{"==>> "} + kind + " result of " + operation + " in unit " +
+                                   label_name<LABEL>::name() + " <<=="};
+        }
+
+        /*
+         * It returns a finite value, otherwise it throws arithmetic_error. value - value is zero only when value
+         * is finite, so the check is also a constant expression (it requires IEEE arithmetic, no -ffinite-math-only).
+         */
+        template <typename LABEL, typename TY>
+        constexpr TY check_finite(TY value, char const *operation)
+        {
+            return (value - value == 0) ? value : (throw_arithmetic_error<LABEL>(value, operation), value);
+        }
+    } // namespace utils
+    ///@endcond
+#endif
+
     /**
      * @brief
      * Class template representing a strong unit type
@@ -293,14 +741,19 @@ namespace stu
         TYPE value_{};
 
     public:
-        constexpr explicit Unit(TYPE value = 0) : value_{value} {}
+        using type = TYPE;
+        using quantity = QUANTITY;
+        using scale = SCALE;
+        using label = LABEL;
+
+        constexpr explicit Unit(TYPE value = 0) : value_{STU_CHECKED(LABEL, value, "construction")} {}
         Unit(Unit const &other) = default;
         Unit(Unit &&other) noexcept = default;
         ~Unit() = default;
 
-        Unit &operator=(Unit other) noexcept
+        constexpr Unit &operator=(Unit other) noexcept
         {
-            std::swap(value_, other.value_);
+            value_ = other.value_;
             return *this;
         }
 
@@ -308,77 +761,82 @@ namespace stu
          * @brief `operator()`.
          * It returns the type wrapped by this class
          */
-        TYPE operator()() const { return value_; }
+        constexpr TYPE operator()() const { return value_; }
 
         /**
          * @brief Prints a unit information.
          * It streams value, quantity, and scale information to the standard output.
+         * @note It requires `StrongUnitIO.h`.
          */
         void print() const
         {
-            std::cout << (*this) << " ["
-                      << "<" << QUANTITY::b0e.num << ":" << QUANTITY::b0e.den << ">"
-                      << "<" << QUANTITY::b1e.num << ":" << QUANTITY::b1e.den << ">"
-                      << "<" << QUANTITY::b2e.num << ":" << QUANTITY::b2e.den << ">"
-                      << "<" << QUANTITY::b3e.num << ":" << QUANTITY::b3e.den << ">"
-                      << "<" << QUANTITY::b4e.num << ":" << QUANTITY::b4e.den << ">"
-                      << "<" << QUANTITY::b5e.num << ":" << QUANTITY::b5e.den << ">"
-                      << "<" << QUANTITY::b6e.num << ":" << QUANTITY::b6e.den << ">"
-                      << "<" << QUANTITY::b7e.num << ":" << QUANTITY::b7e.den << ">"
-                      << "<" << QUANTITY::b8e.num << ":" << QUANTITY::b8e.den << ">"
-                      << "<" << QUANTITY::b9e.num << ":" << QUANTITY::b9e.den << ">"
-                      << " ; S=" << 1.0 * SCALE::up_ / SCALE::dn_ << "]\n";
+            print_unit(*this);
         }
 
-        template <typename TY, typename QU, typename SC, typename LA>
-        friend std::istream &operator>>(std::istream &is, Unit<TY, QU, SC, LA> &a_unit);
+#ifdef STU_EXPLICIT_CONVERSIONS
+        /**
+         * @brief
+         * Implicit conversion to a unit of the same quantity and scale (e.g. an alias unit), no value change
+         */
+        template <typename OTHER_LABEL>
+        constexpr operator Unit<TYPE, QUANTITY, SCALE, OTHER_LABEL>() const
+        {
+            return Unit<TYPE, QUANTITY, SCALE, OTHER_LABEL>{value_};
+        }
+#endif
 
         /**
          * @brief
          * Implicit linear conversion member function "operator type ()" from a unit to another of the same quantity
+         * (explicit with `STU_EXPLICIT_CONVERSIONS`, see `stu::unit_cast`). The audit counts the run time conversions only.
          * @tparam OTHER_SCALE scale type for unit linear conversion
          * @tparam OTHER_LABEL label type for tagging printed units
          * @return Unit<TYPE, QUANTITY, OTHER_SCALE, OTHER_LABEL>
          */
         template <typename OTHER_SCALE, typename OTHER_LABEL>
-        operator Unit<TYPE, QUANTITY, OTHER_SCALE, OTHER_LABEL>() const
+        STU_CONVERSION_SPECIFIER constexpr operator Unit<TYPE, QUANTITY, OTHER_SCALE, OTHER_LABEL>() const
         {
+#ifdef STU_CONVERSION_AUDIT
+            if (!STU_CONSTANT_EVALUATED())
+            {
+                utils::conversion_audit<QUANTITY, SCALE, OTHER_SCALE>::count();
+            }
+#endif
             return Unit<TYPE, QUANTITY, OTHER_SCALE, OTHER_LABEL>{
-                static_cast<TYPE>(1.0 * value_ * SCALE::up_ / SCALE::dn_ *
-                                  OTHER_SCALE::dn_ / OTHER_SCALE::up_)};
+                utils::scale_conversion<TYPE, SCALE, OTHER_SCALE>::apply(value_)};
         }
 
-        Unit &operator+=(Unit const &other)
+        constexpr Unit &operator+=(Unit const &other)
         {
-            value_ += other.value_;
+            value_ = STU_CHECKED(LABEL, value_ + other.value_, "operator+=");
             return *this;
         }
 
-        Unit &operator-=(Unit const &other)
+        constexpr Unit &operator-=(Unit const &other)
         {
-            value_ -= other.value_;
+            value_ = STU_CHECKED(LABEL, value_ - other.value_, "operator-=");
             return *this;
         }
 
         /**
          * @brief
-         * @note `floating point` to `integer` conversion
+         * @note It uses `std::fmod`: the result has the sign of the dividend.
          */
-        Unit &operator%=(Unit const &other)
+        constexpr Unit &operator%=(Unit const &other)
         {
-            value_ = static_cast<int>(value_) % static_cast<int>(other.value_);
+            value_ = STU_CHECKED(LABEL, utils::math::fmod(value_, other.value_), "operator%=");
             return *this;
         }
 
         // prefix increment
-        Unit &operator++()
+        constexpr Unit &operator++()
         {
-            ++value_;
+            value_ = STU_CHECKED(LABEL, value_ + 1, "operator++");
             return *this;
         }
 
         // postfix increment
-        Unit operator++(int)
+        constexpr Unit operator++(int)
         {
             Unit old = *this;
             operator++();
@@ -386,14 +844,14 @@ namespace stu
         }
 
         // prefix decrement
-        Unit &operator--()
+        constexpr Unit &operator--()
         {
-            --value_;
+            value_ = STU_CHECKED(LABEL, value_ - 1, "operator--");
             return *this;
         }
 
         // postfix decrement
-        Unit operator--(int)
+        constexpr Unit operator--(int)
         {
             Unit old = *this;
             operator--();
@@ -407,20 +865,35 @@ namespace stu
     {
         struct numeral_label
         {
-            numeral_label(){};
-            std::string label_{"u_"};
+            static constexpr char const *name() { return "u_"; }
         };
 
         struct numeral_rad_label
         {
-            numeral_rad_label(){};
-            std::string label_{"rad_"};
+            static constexpr char const *name() { return "rad_"; }
         };
 
         struct numeral_sr_label
         {
-            numeral_sr_label(){};
-            std::string label_{"sr_"};
+            static constexpr char const *name() { return "sr_"; }
+        };
+
+        struct numeral_deg_label
+        {
+            static constexpr char const *name() { return "deg_"; }
+        };
+
+        /* Label of the base quantity `index`, DEF_BASE_LABEL specializes it to name the base unit symbol */
+        template <std::size_t index>
+        struct base_label
+        {
+            static constexpr char const *name() { return nullptr; }
+        };
+
+        /* Label of unnamed derived units, keyed only by their quantity (printed by StrongUnitIO.h) */
+        template <typename QU>
+        struct derived_label
+        {
         };
     } // namespace tag
     ///@endcond
@@ -432,104 +905,120 @@ namespace stu
 
     template <typename TY, class LA = stu::tag::numeral_rad_label>
     using numeral_rad = stu::Unit<TY, stu::Quantity<>,
-                                  stu::Scale<50000000000000000UL,
-                                             314159265358979323UL>,
+                                  stu::Scale<1UL, 2UL, -1>,
                                   LA>;
 
     template <typename TY, typename LA = stu::tag::numeral_sr_label>
     using numeral_sr = stu::Unit<TY, stu::Quantity<>,
-                                 stu::Scale<25000000000000000UL,
-                                            314159265358979323UL>,
+                                 stu::Scale<1UL, 4UL, -1>,
                                  LA>;
 
+    template <typename TY, typename LA = stu::tag::numeral_deg_label>
+    using numeral_deg = stu::Unit<TY, stu::Quantity<>,
+                                  stu::Scale<1UL, 360UL>,
+                                  LA>;
+
+    /// @cond
+    namespace utils
+    {
+        /*
+         * Registry of the named units: DEF_NAMED_UNIT specializes it for the type, quantity and scale of
+         * its unit, so that derived unit operations yield that unit. Otherwise the result is a
+         * canonical unnamed unit, i.e. the same type for the same quantity and scale.
+         */
+        template <typename TY, typename QU, typename SC>
+        struct named_unit
+        {
+            using type = Unit<TY, QU, SC, tag::derived_label<QU>>;
+        };
+        template <typename TY>
+        struct named_unit<TY, Quantity<>, Scale<1UL>>
+        {
+            using type = numeral_unit<TY>;
+        };
+        template <typename TY>
+        struct named_unit<TY, Quantity<>, Scale<1UL, 2UL, -1>>
+        {
+            using type = numeral_rad<TY>;
+        };
+        template <typename TY>
+        struct named_unit<TY, Quantity<>, Scale<1UL, 4UL, -1>>
+        {
+            using type = numeral_sr<TY>;
+        };
+
+        template <typename TY, typename QU, typename SC>
+        using named_unit_t = typename named_unit<TY, QU, SC>::type;
+    } // namespace utils
+    ///@endcond
+
 #ifdef STU_UNIT_TYPE
     using rad = stu::numeral_rad<STU_UNIT_TYPE>;
     using sr = stu::numeral_sr<STU_UNIT_TYPE>;
     using unit = stu::numeral_unit<STU_UNIT_TYPE>;
 #endif
 
-    /**
-     * @brief It streams out the value of a unit.
-     */
-    template <typename TY, typename QU, typename SC, typename LA>
-    std::ostream &operator<<(std::ostream &os, Unit<TY, QU, SC, LA> const &a_unit)
-    {
-        os << a_unit() << "*" << LA{}.label_;
-        return os;
-    }
-
-    /**
-     * @brief It streams in a numeric value to a unit.
-     * @note It throws an instance of `std::invalid_argument` if the argument is not a number.
-     */
-    template <typename TY, typename QU, typename SC, typename LA>
-    std::istream &operator>>(std::istream &is, Unit<TY, QU, SC, LA> &a_unit)
-    {
-        std::string data;
-        is >> data;
-        if (data.empty())
-            is.setstate(std::ios::failbit);
-        else
-            a_unit.value_ = static_cast<TY>(std::stold(data));
-        return is;
-    }
-
     template <typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
-    bool operator<(Unit<TY, QU, SC1, LA1> const &left, Unit<TY, QU, SC2, LA2> const &right)
+    constexpr bool operator<(Unit<TY, QU, SC1, LA1> const &left, Unit<TY, QU, SC2, LA2> const &right)
     {
+        STU_ASSERT_NO_CONVERSION(SC2, SC1);
         return (left() < (static_cast<Unit<TY, QU, SC1, LA1>>(right))());
     }
 
     template <typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
-    bool operator>(Unit<TY, QU, SC1, LA1> const &left, Unit<TY, QU, SC2, LA2> const &right)
+    constexpr bool operator>(Unit<TY, QU, SC1, LA1> const &left, Unit<TY, QU, SC2, LA2> const &right)
     {
         return (right < left);
     }
 
     template <typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
-    bool operator<=(Unit<TY, QU, SC1, LA1> const &left, Unit<TY, QU, SC2, LA2> const &right)
+    constexpr bool operator<=(Unit<TY, QU, SC1, LA1> const &left, Unit<TY, QU, SC2, LA2> const &right)
     {
         return (!(left > right));
     }
 
     template <typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
-    bool operator>=(Unit<TY, QU, SC1, LA1> const &left, Unit<TY, QU, SC2, LA2> const &right)
+    constexpr bool operator>=(Unit<TY, QU, SC1, LA1> const &left, Unit<TY, QU, SC2, LA2> const &right)
     {
         return (!(left < right));
     }
 
     template <typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
-    bool operator==(Unit<TY, QU, SC1, LA1> const &left, Unit<TY, QU, SC2, LA2> const &right)
+    constexpr bool operator==(Unit<TY, QU, SC1, LA1> const &left, Unit<TY, QU, SC2, LA2> const &right)
     {
         return (!(left < right) && !(left > right));
     }
 
     template <typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
-    bool operator!=(Unit<TY, QU, SC1, LA1> const &left, Unit<TY, QU, SC2, LA2> const &right)
+    constexpr bool operator!=(Unit<TY, QU, SC1, LA1> const &left, Unit<TY, QU, SC2, LA2> const &right)
     {
         return ((left < right) || (left > right));
     }
 
     template <typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
-    Unit<TY, QU, SC1, LA1> operator+(Unit<TY, QU, SC1, LA1> first, Unit<TY, QU, SC2, LA2> const &second)
+    constexpr Unit<TY, QU, SC1, LA1> operator+(Unit<TY, QU, SC1, LA1> first, Unit<TY, QU, SC2, LA2> const &second)
     {
+        STU_ASSERT_NO_CONVERSION(SC2, SC1);
         first += static_cast<Unit<TY, QU, SC1, LA1>>(second);
         return first;
     }
 
     template <typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
-    Unit<TY, QU, SC1, LA1> operator-(Unit<TY, QU, SC1, LA1> first, Unit<TY, QU, SC2, LA2> const &second)
+    constexpr Unit<TY, QU, SC1, LA1> operator-(Unit<TY, QU, SC1, LA1> first, Unit<TY, QU, SC2, LA2> const &second)
     {
+        STU_ASSERT_NO_CONVERSION(SC2, SC1);
         first -= static_cast<Unit<TY, QU, SC1, LA1>>(second);
         return first;
     }
 
     /**
-     * @brief `floating point` to `integer` conversion
+     * @brief
+     * Floating point remainder (`std::fmod`) of `first` divided by `second` converted to the scale of `first`.
      */
     template <typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
-    Unit<TY, QU, SC1, LA1> operator%(Unit<TY, QU, SC1, LA1> first, Unit<TY, QU, SC2, LA2> const &second)
+    constexpr Unit<TY, QU, SC1, LA1> operator%(Unit<TY, QU, SC1, LA1> first, Unit<TY, QU, SC2, LA2> const &second)
     {
+        STU_ASSERT_NO_CONVERSION(SC2, SC1);
         first %= static_cast<Unit<TY, QU, SC1, LA1>>(second);
         return first;
     }
@@ -538,55 +1027,45 @@ namespace stu
      * @brief It allows double*Unit.
      */
     template <typename TY, typename QU, typename SC, typename LA>
-    auto operator*(long double const &first, Unit<TY, QU, SC, LA> const &second)
+    constexpr auto operator*(long double const &first, Unit<TY, QU, SC, LA> const &second)
     {
-        return Unit<TY, QU, SC, LA>{static_cast<TY>(first * second())};
+        return Unit<TY, QU, SC, LA>{static_cast<TY>(first) * second()};
     }
 
     /**
      * @brief It allows Unit*double.
      */
     template <typename TY, typename QU, typename SC, typename LA>
-    auto operator*(Unit<TY, QU, SC, LA> const &first, long double const &second)
+    constexpr auto operator*(Unit<TY, QU, SC, LA> const &first, long double const &second)
     {
-        return Unit<TY, QU, SC, LA>{static_cast<TY>(first() * second)};
+        return Unit<TY, QU, SC, LA>{first() * static_cast<TY>(second)};
     }
 
     /**
      * @brief It allows Unit*Unit.
      */
     template <typename TY, typename QU1, typename SC1, typename QU2, typename SC2, typename LA1, typename LA2>
-    auto operator*(Unit<TY, QU1, SC1, LA1> const &first, Unit<TY, QU2, SC2, LA2> const &second)
+    constexpr auto operator*(Unit<TY, QU1, SC1, LA1> const &first, Unit<TY, QU2, SC2, LA2> const &second)
     {
-        static constexpr auto sc_up{SC1::up_ * SC2::up_};
-        static constexpr auto sc_dn{SC1::dn_ * SC2::dn_};
-
-        struct combined_label
-        {
-            combined_label(){};
-            std::string label_ = LA1{}.label_ + "*" + LA2{}.label_;
-        };
-
-        return Unit<TY,
-                    utils::mul_quantities_t<QU1, QU2>,
-                    Scale<sc_up, sc_dn>,
-                    combined_label>{first() * second()};
+        return utils::named_unit_t<TY,
+                                   utils::mul_quantities_t<QU1, QU2>,
+                                   utils::mul_scales_t<SC1, SC2>>{first() * second()};
     }
 
     /**
      * @brief It allows Unit/double.
      */
     template <typename TY, typename QU, typename SC, typename LA>
-    auto operator/(Unit<TY, QU, SC, LA> const &numerator, long double const &denominator)
+    constexpr auto operator/(Unit<TY, QU, SC, LA> const &numerator, long double const &denominator)
     {
-        return Unit<TY, QU, SC, LA>{static_cast<TY>(numerator() / denominator)};
+        return Unit<TY, QU, SC, LA>{numerator() / static_cast<TY>(denominator)};
     }
 
     /**
      * @brief It allows double/Unit.
      */
     template <typename TY, typename QU, typename SC, typename LA>
-    auto operator/(long double const &numerator, Unit<TY, QU, SC, LA> const &denominator)
+    constexpr auto operator/(long double const &numerator, Unit<TY, QU, SC, LA> const &denominator)
     {
         stu::numeral_unit<TY> num_unit{static_cast<TY>(numerator)};
         return (num_unit / denominator);
@@ -596,209 +1075,246 @@ namespace stu
      * @brief It allows Unit/Unit.
      */
     template <typename TY, typename QU1, typename SC1, typename QU2, typename SC2, typename LA1, typename LA2>
-    auto operator/(Unit<TY, QU1, SC1, LA1> const &numerator, Unit<TY, QU2, SC2, LA2> const &denominator)
+    constexpr auto operator/(Unit<TY, QU1, SC1, LA1> const &numerator, Unit<TY, QU2, SC2, LA2> const &denominator)
     {
-        static constexpr auto sc_up{SC1::up_ * SC2::dn_};
-        static constexpr auto sc_dn{SC1::dn_ * SC2::up_};
-
-        struct combined_label
-        {
-            combined_label(){};
-            std::string label_ = LA1{}.label_ + "*(" + LA2{}.label_ + ")^-1";
-        };
+        return utils::named_unit_t<TY,
+                                   utils::div_quantities_t<QU1, QU2>,
+                                   utils::div_scales_t<SC1, SC2>>{numerator() / denominator()};
+    }
 
-        return Unit<TY,
-                    utils::div_quantities_t<QU1, QU2>,
-                    Scale<sc_up, sc_dn>,
-                    combined_label>{numerator() / denominator()};
+    /**
+     * @brief It converts `value` to the unit `TO` of the same quantity, i.e. the explicit form of a scale conversion.
+     */
+    template <typename TO, typename FROM>
+    constexpr TO unit_cast(FROM const &value)
+    {
+        return static_cast<TO>(value);
     }
 
     // MATH FUNCTIONS
     template <typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
-    Unit<TY, QU, SC1, LA1> max(Unit<TY, QU, SC1, LA1> first, Unit<TY, QU, SC2, LA2> second)
+    constexpr Unit<TY, QU, SC1, LA1> max(Unit<TY, QU, SC1, LA1> first, Unit<TY, QU, SC2, LA2> second)
     {
+        STU_ASSERT_NO_CONVERSION(SC2, SC1);
         return (first > second) ? first : static_cast<Unit<TY, QU, SC1, LA1>>(second);
     }
 
     template <typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
-    Unit<TY, QU, SC1, LA1> min(Unit<TY, QU, SC1, LA1> first, Unit<TY, QU, SC2, LA2> second)
+    constexpr Unit<TY, QU, SC1, LA1> min(Unit<TY, QU, SC1, LA1> first, Unit<TY, QU, SC2, LA2> second)
     {
+        STU_ASSERT_NO_CONVERSION(SC2, SC1);
         return (first < second) ? first : static_cast<Unit<TY, QU, SC1, LA1>>(second);
     }
 
     template <typename TY, typename QU, typename SC, typename LA>
-    auto abs(Unit<TY, QU, SC, LA> const &value)
+    constexpr auto abs(Unit<TY, QU, SC, LA> const &value)
     {
-        return Unit<TY, QU, SC, LA>{std::abs(value())};
+        return Unit<TY, QU, SC, LA>{utils::math::abs(value())};
     }
 
     template <typename TY, typename QU, typename SC, typename LA>
-    auto ceil(Unit<TY, QU, SC, LA> const &value)
+    constexpr auto ceil(Unit<TY, QU, SC, LA> const &value)
     {
-        return Unit<TY, QU, SC, LA>{std::ceil(value())};
+        return Unit<TY, QU, SC, LA>{utils::math::ceil(value())};
     }
 
     template <typename TY, typename QU, typename SC, typename LA>
-    auto floor(Unit<TY, QU, SC, LA> const &value)
+    constexpr auto floor(Unit<TY, QU, SC, LA> const &value)
     {
-        return Unit<TY, QU, SC, LA>{std::floor(value())};
+        return Unit<TY, QU, SC, LA>{utils::math::floor(value())};
     }
 
     template <typename TY, typename QU, typename SC, typename LA>
-    auto round(Unit<TY, QU, SC, LA> const &value)
+    constexpr auto round(Unit<TY, QU, SC, LA> const &value)
+    {
+        return Unit<TY, QU, SC, LA>{utils::math::round(value())};
+    }
+
+    template <typename TY, typename LA>
+    constexpr auto exp(stu::numeral_unit<TY, LA> const &value)
+    {
+        return stu::numeral_unit<TY>{utils::math::exp(value())};
+    }
+
+    template <typename TY, typename LA>
+    constexpr auto log(stu::numeral_unit<TY, LA> const &value)
+    {
+        return stu::numeral_unit<TY>{utils::math::log(value())};
+    }
+
+    template <typename TY, typename LA>
+    constexpr auto log10(stu::numeral_unit<TY, LA> const &value)
+    {
+        return stu::numeral_unit<TY>{utils::math::log10(value())};
+    }
+
+    template <typename TY, typename LA>
+    constexpr auto sin(stu::numeral_rad<TY, LA> const &value)
     {
-        return Unit<TY, QU, SC, LA>{std::round(value())};
+        return stu::numeral_unit<TY>{utils::math::sin(value())};
     }
 
     template <typename TY, typename LA>
-    auto exp(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto cos(stu::numeral_rad<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::exp(value())};
+        return stu::numeral_unit<TY>{utils::math::cos(value())};
     }
 
     template <typename TY, typename LA>
-    auto log(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto tan(stu::numeral_rad<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::log(value())};
+        return stu::numeral_unit<TY>{utils::math::tan(value())};
     }
 
+    /**
+     * @brief It returns the pair (sin, cos) of an angle.
+     */
     template <typename TY, typename LA>
-    auto log10(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto sincos(stu::numeral_rad<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::log10(value())};
+        return std::make_pair(stu::numeral_unit<TY>{utils::math::sin(value())}, stu::numeral_unit<TY>{utils::math::cos(value())});
     }
 
+    /**
+     * @brief Trigonometric functions of degree angles, the conversion to radians is a single multiply.
+     */
     template <typename TY, typename LA>
-    auto sin(stu::numeral_rad<TY, LA> const &value)
+    constexpr auto sin(stu::numeral_deg<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::sin(value())};
+        return stu::sin(static_cast<stu::numeral_rad<TY>>(value));
     }
 
     template <typename TY, typename LA>
-    auto cos(stu::numeral_rad<TY, LA> const &value)
+    constexpr auto cos(stu::numeral_deg<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::cos(value())};
+        return stu::cos(static_cast<stu::numeral_rad<TY>>(value));
     }
 
     template <typename TY, typename LA>
-    auto tan(stu::numeral_rad<TY, LA> const &value)
+    constexpr auto tan(stu::numeral_deg<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::tan(value())};
+        return stu::tan(static_cast<stu::numeral_rad<TY>>(value));
     }
 
     template <typename TY, typename LA>
-    auto asin(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto sincos(stu::numeral_deg<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::asin(value())};
+        return stu::sincos(static_cast<stu::numeral_rad<TY>>(value));
     }
 
     template <typename TY, typename LA>
-    auto acos(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto asin(stu::numeral_unit<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::acos(value())};
+        return stu::numeral_unit<TY>{utils::math::asin(value())};
     }
 
     template <typename TY, typename LA>
-    auto atan(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto acos(stu::numeral_unit<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::atan(value())};
+        return stu::numeral_unit<TY>{utils::math::acos(value())};
     }
 
     template <typename TY, typename LA>
-    auto sinh(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto atan(stu::numeral_unit<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::sinh(value())};
+        return stu::numeral_unit<TY>{utils::math::atan(value())};
     }
 
     template <typename TY, typename LA>
-    auto cosh(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto sinh(stu::numeral_unit<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::cosh(value())};
+        return stu::numeral_unit<TY>{utils::math::sinh(value())};
     }
 
     template <typename TY, typename LA>
-    auto tanh(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto cosh(stu::numeral_unit<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::tanh(value())};
+        return stu::numeral_unit<TY>{utils::math::cosh(value())};
     }
 
     template <typename TY, typename LA>
-    auto asinh(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto tanh(stu::numeral_unit<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::asinh(value())};
+        return stu::numeral_unit<TY>{utils::math::tanh(value())};
     }
 
     template <typename TY, typename LA>
-    auto acosh(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto asinh(stu::numeral_unit<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::acosh(value())};
+        return stu::numeral_unit<TY>{utils::math::asinh(value())};
     }
 
     template <typename TY, typename LA>
-    auto atanh(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto acosh(stu::numeral_unit<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::atanh(value())};
+        return stu::numeral_unit<TY>{utils::math::acosh(value())};
     }
 
     template <typename TY, typename LA>
-    auto pow(stu::numeral_unit<TY, LA> const &base,
+    constexpr auto atanh(stu::numeral_unit<TY, LA> const &value)
+    {
+        return stu::numeral_unit<TY>{utils::math::atanh(value())};
+    }
+
+    template <typename TY, typename LA>
+    constexpr auto pow(stu::numeral_unit<TY, LA> const &base,
              long double const &exponent)
     {
-        return stu::numeral_unit<TY>{std::pow(base(), static_cast<TY>(exponent))};
+        return stu::numeral_unit<TY>{utils::math::pow(base(), static_cast<TY>(exponent))};
     }
 
     template <typename TY, typename LA>
-    auto pow(stu::numeral_unit<TY, LA> const &base,
+    constexpr auto pow(stu::numeral_unit<TY, LA> const &base,
              stu::numeral_unit<TY, LA> const &exponent)
     {
-        return stu::numeral_unit<TY>{std::pow(base(), exponent())};
+        return stu::numeral_unit<TY>{utils::math::pow(base(), exponent())};
     }
 
     template <std::intmax_t exponent, typename TY, typename QU, typename SC, typename LA>
-    auto pow(Unit<TY, QU, SC, LA> const &base)
+    constexpr auto pow(Unit<TY, QU, SC, LA> const &base)
     {
-        static constexpr auto p_sc_up{utils::ipow(SC::up_, exponent)};
-        static constexpr auto p_sc_dn{utils::ipow(SC::dn_, exponent)};
-        static constexpr auto n_sc_up{utils::ipow(SC::dn_, 0 - exponent)};
-        static constexpr auto n_sc_dn{utils::ipow(SC::up_, 0 - exponent)};
-
-        struct combined_label
-        {
-            combined_label(){};
-            std::string label_ = "(" + LA{}.label_ + ")^" + std::to_string(exponent);
-        };
-
-        return Unit<TY,
-                    utils::pow_quantities_t<QU, std::ratio<exponent>>,
-                    std::conditional_t<(exponent >= 0),
-                                       Scale<p_sc_up, p_sc_dn>,
-                                       Scale<n_sc_up, n_sc_dn>>,
-                    combined_label>{static_cast<TY>(std::pow(base(), exponent))};
+        return utils::named_unit_t<TY,
+                                   utils::pow_quantities_t<QU, std::ratio<exponent>>,
+                                   utils::pow_scales_t<SC, exponent>>{utils::ipow_value<exponent>::apply(base())};
     }
 
     template <typename TY, typename LA>
-    auto sqrt(stu::numeral_unit<TY, LA> const &value)
+    constexpr auto sqrt(stu::numeral_unit<TY, LA> const &value)
     {
-        return stu::numeral_unit<TY>{std::sqrt(value())};
+        return stu::numeral_unit<TY>{utils::math::sqrt(value())};
+    }
+
+    /**
+     * @brief It computes the rational power `base^(num/den)` of a unit.
+     * @note The scale must have an exact den-th root.
+     */
+    template <std::intmax_t num, std::intmax_t den, typename TY, typename QU, typename SC, typename LA>
+    constexpr auto pow(Unit<TY, QU, SC, LA> const &base)
+    {
+        using exponent = typename std::ratio<num, den>::type;
+
+        return utils::named_unit_t<TY,
+                                   utils::pow_quantities_t<QU, exponent>,
+                                   utils::rpow_scales_t<SC, exponent::num, exponent::den>>{
+            utils::rpow_value<exponent::num, exponent::den>::apply(base())};
     }
 
     template <typename TY, typename QU, typename SC, typename LA>
-    auto sqrt(Unit<TY, QU, SC, LA> const &value)
+    constexpr auto sqrt(Unit<TY, QU, SC, LA> const &value)
     {
-        constexpr auto sc_up{utils::isqrt(SC::up_)};
-        constexpr auto sc_dn{utils::isqrt(SC::dn_)};
-        static_assert(sc_up > 0 && sc_dn > 0, "==>> INVALID SCALE! <<==");
+        return stu::pow<1, 2>(value);
+    }
 
-        struct combined_label
-        {
-            combined_label(){};
-            std::string label_ = "(" + LA{}.label_ + ")^1/2";
-        };
+    template <std::intmax_t degree, typename TY, typename QU, typename SC, typename LA>
+    constexpr auto root(Unit<TY, QU, SC, LA> const &value)
+    {
+        return stu::pow<1, degree>(value);
+    }
 
-        return Unit<TY,
-                    utils::pow_quantities_t<QU, std::ratio<1, 2>>,
-                    Scale<sc_up, sc_dn>,
-                    combined_label>{std::sqrt(value())};
+    template <typename TY, typename QU, typename SC, typename LA>
+    constexpr auto cbrt(Unit<TY, QU, SC, LA> const &value)
+    {
+        return stu::pow<1, 3>(value);
     }
 
     /**
@@ -810,13 +1326,17 @@ namespace stu
     namespace constants
     {
 #ifdef STU_UNIT_TYPE
-        static constexpr const unit PI{3.14159265358979323};
-        static constexpr const unit E{2.71828182845904523};
-        static constexpr const unit _0{0};
-        static constexpr const unit _1{1};
+        STU_DEF_SYMBOL(unit, PI, 3.14159265358979323)
+        STU_DEF_SYMBOL(unit, E, 2.71828182845904523)
+        STU_DEF_SYMBOL(unit, _0, 0)
+        STU_DEF_SYMBOL(unit, _1, 1)
 #endif
     } // namespace constants
 
 } // namespace stu
 
-#endif // STRONGUNIT_H
\ No newline at end of file
+#ifdef STU_CONVERSION_AUDIT
+#include "StrongUnitAudit.h"
+#endif
+
+#endif // STRONGUNIT_H
\ No newline at end of file
@@ -0,0 +1,250 @@
+/**
+ * @file StrongUnitAudit.h
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Conversion audit of Strong Unit scale conversions (STU_CONVERSION_AUDIT)
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STRONGUNITAUDIT_H
+#define STRONGUNITAUDIT_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "StrongUnit.h"
+
+namespace stu
+{
+    /// @cond
+    namespace utils /* Conversion audit: counters of the scale conversions per quantity and pair of scales */
+    {
+        struct conversion_site;
+
+        /*
+         * Lock-free list of the conversion sites used by the program, it prints the report at exit.
+         */
+        class conversion_registry final
+        {
+            std::atomic<conversion_site *> head_{nullptr};
+
+        public:
+            static conversion_registry &instance()
+            {
+                static conversion_registry registry;
+                return registry;
+            }
+
+            conversion_site *head() const { return head_.load(std::memory_order_acquire); }
+
+            inline void add(conversion_site &site);
+
+            inline void report(std::FILE *stream) const;
+
+            ~conversion_registry()
+            {
+                report(stderr);
+            }
+        };
+
+        /*
+         * Total conversions of a (quantity, from-scale, to-scale) key, flushed by the thread-local counters.
+         * It is trivially destructible, so the registry can read it until the end of the program.
+         */
+        struct conversion_site
+        {
+            std::atomic<std::uint64_t> count_{0};
+            conversion_site *next_{nullptr};
+            char description_[192]{};
+        };
+
+        inline void conversion_registry::add(conversion_site &site)
+        {
+            site.next_ = head_.load(std::memory_order_relaxed);
+            while (!head_.compare_exchange_weak(site.next_, &site, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        inline void conversion_registry::report(std::FILE *stream) const
+        {
+            std::vector<conversion_site const *> sites;
+            for (conversion_site const *site = head(); site != nullptr; site = site->next_)
+            {
+                if (site->count_.load(std::memory_order_relaxed) != 0U)
+                    sites.push_back(site);
+            }
+            if (sites.empty())
+                return;
+
+            std::sort(sites.begin(), sites.end(), [](conversion_site const *first, conversion_site const *second)
+                      { return first->count_.load(std::memory_order_relaxed) > second->count_.load(std::memory_order_relaxed); });
+
+            std::fprintf(stream, "stu conversion audit (count, quantity, from scale -> to scale):\n");
+            for (conversion_site const *site : sites)
+            {
+                std::fprintf(stream, "%20llu  %s\n",
+                             static_cast<unsigned long long>(site->count_.load(std::memory_order_relaxed)), site->description_);
+            }
+        }
+
+        /* It appends the printf formatted text to the description */
+        template <typename... ARGS>
+        void describe(char *buffer, std::size_t size, std::size_t &length, char const *format, ARGS... args)
+        {
+            if (length < size)
+            {
+                int const written = std::snprintf(buffer + length, size - length, format, args...);
+                length += (written > 0) ? static_cast<std::size_t>(written) : 0U;
+            }
+        }
+
+        /* Base unit label, looked up when the quantity is described so that DEF_BASE_LABEL may follow this header */
+        template <typename QU, std::size_t index>
+        char const *base_name()
+        {
+            return tag::base_label<index>::name();
+        }
+
+        template <typename QU>
+        void describe_quantity(char *buffer, std::size_t size, std::size_t &length)
+        {
+            std::intmax_t const num[]{QU::b0e::num, QU::b1e::num, QU::b2e::num, QU::b3e::num, QU::b4e::num,
+                                      QU::b5e::num, QU::b6e::num, QU::b7e::num, QU::b8e::num, QU::b9e::num};
+            std::intmax_t const den[]{QU::b0e::den, QU::b1e::den, QU::b2e::den, QU::b3e::den, QU::b4e::den,
+                                      QU::b5e::den, QU::b6e::den, QU::b7e::den, QU::b8e::den, QU::b9e::den};
+            char const *const names[]{base_name<QU, 0>(), base_name<QU, 1>(), base_name<QU, 2>(), base_name<QU, 3>(),
+                                      base_name<QU, 4>(), base_name<QU, 5>(), base_name<QU, 6>(), base_name<QU, 7>(),
+                                      base_name<QU, 8>(), base_name<QU, 9>()};
+
+            bool dimensionless{true};
+            for (int i = 0; i < 10; ++i)
+            {
+                if (num[i] == 0)
+                    continue;
+                describe(buffer, size, length, "%s", dimensionless ? "" : "*");
+                if (names[i] != nullptr)
+                    describe(buffer, size, length, "%s", names[i]);
+                else
+                    describe(buffer, size, length, "b%d", i);
+                if (den[i] != 1)
+                    describe(buffer, size, length, "^%jd/%jd", num[i], den[i]);
+                else if (num[i] != 1)
+                    describe(buffer, size, length, "^%jd", num[i]);
+                dimensionless = false;
+            }
+            if (dimensionless)
+                describe(buffer, size, length, "%s", "numeral");
+        }
+
+        template <typename SC>
+        void describe_scale(char *buffer, std::size_t size, std::size_t &length)
+        {
+            describe(buffer, size, length, "%ju", SC::up_);
+            if (SC::dn_ != 1U)
+                describe(buffer, size, length, "/%ju", SC::dn_);
+            if (SC::pi_ != 0)
+                describe(buffer, size, length, "*pi^%jd", SC::pi_);
+        }
+
+        template <typename QU, typename SC1, typename SC2>
+        struct conversion_audit final
+        {
+            static conversion_site &site()
+            {
+                static conversion_site &site_ = make_site();
+                return site_;
+            }
+
+            /* Conversions of the calling thread not yet flushed to the site */
+            struct local_count
+            {
+                std::uint64_t count_{0};
+                local_count() { site(); }
+                ~local_count() { site().count_.fetch_add(count_, std::memory_order_relaxed); }
+            };
+
+            static local_count &local()
+            {
+                static thread_local local_count local_;
+                return local_;
+            }
+
+            static void count() noexcept { ++local().count_; }
+
+            static std::uint64_t total() { return site().count_.load(std::memory_order_relaxed) + local().count_; }
+
+        private:
+            static conversion_site &make_site()
+            {
+                static conversion_site site_;
+                std::size_t length{0};
+                describe_quantity<QU>(site_.description_, sizeof site_.description_, length);
+                describe(site_.description_, sizeof site_.description_, length, "%s", "  ");
+                describe_scale<SC1>(site_.description_, sizeof site_.description_, length);
+                describe(site_.description_, sizeof site_.description_, length, "%s", " -> ");
+                describe_scale<SC2>(site_.description_, sizeof site_.description_, length);
+                conversion_registry::instance().add(site_);
+                return site_;
+            }
+        };
+
+        /* Conversions between the same scale (e.g. alias units) are not counted */
+        template <typename QU, typename SC>
+        struct conversion_audit<QU, SC, SC> final
+        {
+            static void count() noexcept {}
+
+            static std::uint64_t total() { return 0U; }
+        };
+    } // namespace utils
+    ///@endcond
+
+    /**
+     * @brief
+     * It returns the number of scale conversions from `FROM` to `TO` (unit types of the same quantity) counted so far:
+     * the ones of the calling thread and of the threads already exited.
+     */
+    template <typename FROM, typename TO>
+    std::uint64_t conversion_audit_count()
+    {
+        static_assert(std::is_same<typename FROM::quantity, typename TO::quantity>::value, "==>> UNITS OF DIFFERENT QUANTITIES! <<==");
+        return utils::conversion_audit<typename FROM::quantity, typename FROM::scale, typename TO::scale>::total();
+    }
+
+    /**
+     * @brief
+     * It prints the scale conversions counted so far (of the threads already exited), most frequent first.
+     * @note The same report is printed to the standard error at exit.
+     */
+    inline void conversion_audit_report(std::FILE *stream)
+    {
+        utils::conversion_registry::instance().report(stream);
+    }
+
+} // namespace stu
+
+#endif // STRONGUNITAUDIT_H
@@ -0,0 +1,142 @@
+/**
+ * @file StrongUnitChrono.h
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Conversions between Strong Unit times and std::chrono durations
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STRONGUNITCHRONO_H
+#define STRONGUNITCHRONO_H
+
+#include <chrono>
+#include <ratio>
+#include "SIBaseUnits.h"
+
+namespace stu
+{
+    /// @cond
+    namespace utils /* Utilities to convert times to and from std::chrono durations */
+    {
+        /*
+         * Factor from a period (std::ratio) to a scale: it is folded at compile time,
+         * so a conversion is at most one multiply (none when the factor is one).
+         */
+        template <typename TY, typename FROM_PERIOD, typename TO_PERIOD>
+        struct period_conversion
+        {
+            using ratio = std::ratio_divide<FROM_PERIOD, TO_PERIOD>;
+
+            static constexpr TY apply(TY value)
+            {
+                return (ratio::num == 1 && ratio::den == 1) ? value : value * static_cast<TY>(1.0L * ratio::num / ratio::den);
+            }
+        };
+
+        template <typename SC>
+        struct scale_period
+        {
+            static_assert(SC::pi_ == 0, "==>> SCALES WITH A POWER OF PI ARE NOT ALLOWED FOR DURATIONS! <<==");
+            using type = std::ratio<SC::up_, SC::dn_>;
+        };
+    } // namespace utils
+    ///@endcond
+
+    /**
+     * @brief It converts a time unit to a `std::chrono::duration` (truncated toward zero for integer durations).
+     * @tparam DURATION std::chrono::duration type, e.g. std::chrono::nanoseconds
+     */
+    template <typename DURATION, typename TY, typename SC, typename LA>
+    constexpr DURATION to_duration(Unit<TY, quantity::time, SC, LA> const &value)
+    {
+        return DURATION{static_cast<typename DURATION::rep>(
+            utils::period_conversion<TY, typename utils::scale_period<SC>::type, typename DURATION::period>::apply(value()))};
+    }
+
+    /**
+     * @brief It converts a time unit to the `std::chrono::duration` having the same type and scale, e.g. `stu::minute`
+     *        to `std::chrono::duration<double, std::ratio<60>>`, so the conversion is free.
+     */
+    template <typename TY, typename SC, typename LA>
+    constexpr std::chrono::duration<TY, typename utils::scale_period<SC>::type> to_duration(Unit<TY, quantity::time, SC, LA> const &value)
+    {
+        return std::chrono::duration<TY, typename utils::scale_period<SC>::type>{value()};
+    }
+
+    /**
+     * @brief It converts a `std::chrono::duration` to a time unit.
+     * @tparam UNIT time unit, `stu::second` by default
+     */
+    template <typename UNIT = second, typename REP, typename PERIOD>
+    constexpr UNIT from_duration(std::chrono::duration<REP, PERIOD> const &value)
+    {
+        static_assert(std::is_same<typename UNIT::quantity, quantity::time>::value, "==>> DURATIONS CONVERT TO TIME UNITS ONLY! <<==");
+        return UNIT{utils::period_conversion<typename UNIT::type, PERIOD, typename utils::scale_period<typename UNIT::scale>::type>::apply(
+            static_cast<typename UNIT::type>(value.count()))};
+    }
+
+    /**
+     * @brief
+     * Class template measuring the time elapsed from its construction, or from the last `restart`, as a time unit.
+     * @note the cost of `elapsed()` is a `CLOCK::now()` call, a subtraction and the compile-time scaled conversion.
+     * @tparam UNIT  time unit of the elapsed time, `stu::second` by default
+     * @tparam CLOCK std::chrono clock, `std::chrono::steady_clock` by default
+     */
+    template <typename UNIT = second, typename CLOCK = std::chrono::steady_clock>
+    class Stopwatch final
+    {
+        typename CLOCK::time_point start_;
+
+    public:
+        using unit = UNIT;
+        using clock = CLOCK;
+
+        Stopwatch() noexcept : start_{CLOCK::now()} {}
+
+        void restart() noexcept { start_ = CLOCK::now(); }
+
+        /**
+         * @brief It returns the time elapsed since the start.
+         */
+        UNIT elapsed() const STU_NOEXCEPT_UNCHECKED
+        {
+            return from_duration<UNIT>(CLOCK::now() - start_);
+        }
+
+        /**
+         * @brief It returns the time elapsed since the start and restarts the stopwatch.
+         */
+        UNIT lap() STU_NOEXCEPT_UNCHECKED
+        {
+            auto const now = CLOCK::now();
+            auto const res = from_duration<UNIT>(now - start_);
+            start_ = now;
+            return res;
+        }
+
+    }; // Stopwatch
+
+} // namespace stu
+
+#endif // STRONGUNITCHRONO_H
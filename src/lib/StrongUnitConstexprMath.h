@@ -0,0 +1,740 @@
+/**
+ * @file StrongUnitConstexprMath.h
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Constant-evaluable math functions of the strong unit values
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STRONGUNITCONSTEXPRMATH_H
+#define STRONGUNITCONSTEXPRMATH_H
+
+#include <type_traits>
+#include <cmath>
+#include <limits>
+
+/**
+ * @brief
+ * It is true while a constant expression is evaluated (e.g. the initializer of a `constexpr` variable or the
+ * constant initialization of a static variable), false at run time. The math functions of the strong units
+ * evaluate their constexpr implementations when it is true, the `<cmath>` functions otherwise.
+ * @note Without `std::is_constant_evaluated` or `__builtin_is_constant_evaluated` it is always false: the math
+ *       functions always call `<cmath>` and they are not usable in constant expressions.
+ */
+#if defined(__cpp_lib_is_constant_evaluated)
+#define STU_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define STU_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define STU_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+#ifndef STU_CONSTANT_EVALUATED
+#define STU_CONSTANT_EVALUATED() false
+#endif
+
+namespace stu
+{
+    /// @cond
+    namespace utils /* Constexpr math: long double implementations of the <cmath> functions */
+    {
+        constexpr long double constexpr_pi() { return 3.14159265358979323846264338327950288L; }
+        constexpr long double constexpr_ln2() { return 0.693147180559945309417232121458176568L; }
+        constexpr long double constexpr_inv_ln10() { return 0.434294481903251827651128918916605082L; }
+        constexpr long double constexpr_sqrt3() { return 1.73205080756887729352744634150587237L; }
+
+        constexpr long double constexpr_nan() { return std::numeric_limits<long double>::quiet_NaN(); }
+        constexpr long double constexpr_inf() { return std::numeric_limits<long double>::infinity(); }
+
+        constexpr bool constexpr_isnan(long double x) { return x != x; }
+
+        constexpr bool constexpr_isinf(long double x)
+        {
+            return (x > std::numeric_limits<long double>::max()) || (x < -std::numeric_limits<long double>::max());
+        }
+
+        /* Largest argument of exp and smallest one of a non-zero result */
+        constexpr long double constexpr_max_log()
+        {
+            return std::numeric_limits<long double>::max_exponent * constexpr_ln2();
+        }
+
+        constexpr long double constexpr_min_log()
+        {
+            return (std::numeric_limits<long double>::min_exponent - std::numeric_limits<long double>::digits - 1) *
+                   constexpr_ln2();
+        }
+
+        /* It converts a result to TY, the values out of the range of TY become infinities */
+        template <typename TY>
+        constexpr TY constexpr_narrow(long double x)
+        {
+            return (x > std::numeric_limits<TY>::max())    ? std::numeric_limits<TY>::infinity()
+                   : (x < -std::numeric_limits<TY>::max()) ? -std::numeric_limits<TY>::infinity()
+                                                           : static_cast<TY>(x);
+        }
+
+        constexpr long double constexpr_abs(long double x)
+        {
+            return (x == 0) ? 0.0L : ((x < 0) ? -x : x);
+        }
+
+        /* Values of magnitude 2^63 or more are integers (the long double significand has 64 bits at most) */
+        constexpr long double constexpr_trunc(long double x)
+        {
+            return (constexpr_isnan(x) || constexpr_abs(x) >= 9223372036854775808.0L)
+                       ? x
+                       : static_cast<long double>(static_cast<long long>(x));
+        }
+
+        constexpr long double constexpr_floor(long double x)
+        {
+            return (constexpr_trunc(x) > x) ? constexpr_trunc(x) - 1 : constexpr_trunc(x);
+        }
+
+        constexpr long double constexpr_ceil(long double x)
+        {
+            return (constexpr_trunc(x) < x) ? constexpr_trunc(x) + 1 : constexpr_trunc(x);
+        }
+
+        /* Half-way cases are rounded away from zero */
+        constexpr long double constexpr_round(long double x)
+        {
+            return (x - constexpr_trunc(x) >= 0.5L)    ? constexpr_trunc(x) + 1
+                   : (x - constexpr_trunc(x) <= -0.5L) ? constexpr_trunc(x) - 1
+                                                       : constexpr_trunc(x);
+        }
+
+        /*
+         * Exact remainder with the sign of the dividend: the divisor is doubled up to the dividend, then
+         * every halving is subtracted when it fits, as in a binary long division.
+         */
+        constexpr long double constexpr_fmod(long double x, long double y)
+        {
+            if (constexpr_isnan(x) || constexpr_isnan(y) || constexpr_isinf(x) || y == 0)
+            {
+                return constexpr_nan();
+            }
+            long double const divisor{constexpr_abs(y)};
+            long double rest{constexpr_abs(x)};
+            if (rest < divisor)
+            {
+                return x;
+            }
+            long double multiple{divisor};
+            while (multiple <= rest / 2)
+            {
+                multiple *= 2;
+            }
+            while (multiple >= divisor)
+            {
+                if (rest >= multiple)
+                {
+                    rest -= multiple;
+                }
+                multiple /= 2;
+            }
+            return (x < 0) ? -rest : rest;
+        }
+
+        /* It returns x * 2^exponent, multiplying by 2^±32 at a time */
+        constexpr long double constexpr_scale2(long double x, long exponent)
+        {
+            for (; exponent >= 32; exponent -= 32)
+            {
+                x *= 4294967296.0L;
+            }
+            for (; exponent <= -32; exponent += 32)
+            {
+                x /= 4294967296.0L;
+            }
+            for (; exponent > 0; --exponent)
+            {
+                x *= 2;
+            }
+            for (; exponent < 0; ++exponent)
+            {
+                x /= 2;
+            }
+            return x;
+        }
+
+        /* It splits a positive finite x into mantissa in [1, 2) and exponent, x = mantissa * 2^exponent */
+        constexpr long double constexpr_split2(long double x, long &exponent)
+        {
+            exponent = 0;
+            for (; x >= 4294967296.0L; exponent += 32)
+            {
+                x /= 4294967296.0L;
+            }
+            for (; x < 1 / 4294967296.0L; exponent -= 32)
+            {
+                x *= 4294967296.0L;
+            }
+            for (; x >= 2; ++exponent)
+            {
+                x /= 2;
+            }
+            for (; x < 1; --exponent)
+            {
+                x *= 2;
+            }
+            return x;
+        }
+
+        /* Newton iterations on the mantissa in [1, 4), then the halved exponent is restored */
+        constexpr long double constexpr_sqrt(long double x)
+        {
+            if (constexpr_isnan(x) || x < 0)
+            {
+                return constexpr_nan();
+            }
+            if (x == 0 || constexpr_isinf(x))
+            {
+                return x;
+            }
+            long exponent{};
+            long double mantissa{constexpr_split2(x, exponent)};
+            if (exponent % 2 != 0)
+            {
+                mantissa *= 2;
+                exponent -= 1;
+            }
+            long double root{(1 + mantissa) / 2};
+            for (int n = 0; n < 8; ++n)
+            {
+                root = (root + mantissa / root) / 2;
+            }
+            return constexpr_scale2(root, exponent / 2);
+        }
+
+        /* Newton iterations on the mantissa in [1, 8), then a third of the exponent is restored */
+        constexpr long double constexpr_cbrt(long double x)
+        {
+            if (constexpr_isnan(x) || x == 0 || constexpr_isinf(x))
+            {
+                return x;
+            }
+            long exponent{};
+            long double mantissa{constexpr_split2(constexpr_abs(x), exponent)};
+            long const rest{((exponent % 3) + 3) % 3};
+            mantissa = constexpr_scale2(mantissa, rest);
+            exponent -= rest;
+            long double root{1.5L};
+            for (int n = 0; n < 8; ++n)
+            {
+                root = (2 * root + mantissa / (root * root)) / 3;
+            }
+            root = constexpr_scale2(root, exponent / 3);
+            return (x < 0) ? -root : root;
+        }
+
+        /*
+         * exp(x) = 2^k * exp(r), where k = round(x / ln2) and r = x - k * ln2 in [-ln2/2, ln2/2] is computed
+         * with a two-part ln2 (the high part has 32 bits, k * high is exact), exp(r) by its Taylor series.
+         */
+        constexpr long double constexpr_exp(long double x)
+        {
+            if (constexpr_isnan(x))
+            {
+                return x;
+            }
+            if (x >= constexpr_max_log())
+            {
+                return constexpr_inf();
+            }
+            if (x < constexpr_min_log())
+            {
+                return 0;
+            }
+            long double const k{constexpr_round(x / constexpr_ln2())};
+            long double const r{(x - k * 0.693147180369123816490173339843750L) - k * 1.90821492927058781614426568075500e-10L};
+            long double term{1};
+            long double res{1};
+            for (int n = 1; n < 30 && res + term != res; ++n)
+            {
+                term = term * r / n;
+                res += term;
+            }
+            return constexpr_scale2(res, static_cast<long>(k));
+        }
+
+        /* Series 2 * atanh(s) = 2 * (s + s^3/3 + s^5/5 + ...), i.e. log((1 + s) / (1 - s)), for small |s| */
+        constexpr long double constexpr_log_series(long double s)
+        {
+            long double power{s};
+            long double res{s};
+            for (int n = 1; n < 40; ++n)
+            {
+                power *= s * s;
+                long double const term{power / (2 * n + 1)};
+                if (res + term == res)
+                {
+                    break;
+                }
+                res += term;
+            }
+            return 2 * res;
+        }
+
+        /* log(x) = e * ln2 + log(m), where x = m * 2^e and m in [sqrt(1/2), sqrt(2)) */
+        constexpr long double constexpr_log(long double x)
+        {
+            if (constexpr_isnan(x) || x < 0)
+            {
+                return constexpr_nan();
+            }
+            if (x == 0)
+            {
+                return -constexpr_inf();
+            }
+            if (constexpr_isinf(x))
+            {
+                return x;
+            }
+            long exponent{};
+            long double mantissa{constexpr_split2(x, exponent)};
+            if (mantissa > 1.41421356237309504880168872420969808L)
+            {
+                mantissa /= 2;
+                exponent += 1;
+            }
+            long double const log_mantissa{constexpr_log_series((mantissa - 1) / (mantissa + 1))};
+            return exponent * 0.693147180369123816490173339843750L +
+                   (exponent * 1.90821492927058781614426568075500e-10L + log_mantissa);
+        }
+
+        /* log(1 + x) = 2 * atanh(x / (2 + x)), accurate for small |x| */
+        constexpr long double constexpr_log1p(long double x)
+        {
+            return (constexpr_abs(x) < 0.25L) ? constexpr_log_series(x / (2 + x)) : constexpr_log(1 + x);
+        }
+
+        constexpr long double constexpr_log10(long double x)
+        {
+            return constexpr_log(x) * constexpr_inv_ln10();
+        }
+
+        /* Taylor series of sin and cos, |x| <= π/4 */
+        constexpr long double constexpr_sin_series(long double x)
+        {
+            long double term{x};
+            long double res{x};
+            for (int n = 1; n < 16 && res + term != res; ++n)
+            {
+                term = -term * x * x / ((2 * n) * (2 * n + 1));
+                res += term;
+            }
+            return res;
+        }
+
+        constexpr long double constexpr_cos_series(long double x)
+        {
+            long double term{1};
+            long double res{1};
+            for (int n = 1; n < 16 && res + term != res; ++n)
+            {
+                term = -term * x * x / ((2 * n - 1) * (2 * n));
+                res += term;
+            }
+            return res;
+        }
+
+        /* number of quadrants below which the products of k by the 32-bit parts of π/2 are exact */
+        constexpr long double constexpr_reduction_limit()
+        {
+            return (std::numeric_limits<long double>::digits >= 64) ? 2147483648.0L : 2097152.0L;
+        }
+
+        /* not constexpr: a call makes the reduction of an argument beyond the limit a non-constant expression */
+        inline long double constexpr_reduction_overflow()
+        {
+            return std::numeric_limits<long double>::quiet_NaN();
+        }
+
+        /*
+         * It reduces x to r in [-π/4, π/4] and to the quadrant k mod 4, x = r + k * π/2: π/2 is split in
+         * four parts of 32 bits, the reduction is exact for |k| < 2^31 (2^21 when long double is double).
+         * Larger arguments are not constant expressions (NaN at run time).
+         */
+        constexpr long double constexpr_reduce_quadrant(long double x, int &quadrant)
+        {
+            long double const k{constexpr_round(x / 1.57079632679489661923132169163975144L)};
+            quadrant = 0;
+            if (constexpr_abs(k) >= constexpr_reduction_limit())
+            {
+                return constexpr_reduction_overflow();
+            }
+            quadrant = static_cast<int>(constexpr_fmod(k, 4));
+            quadrant = (quadrant < 0) ? quadrant + 4 : quadrant;
+            return (((x - k * 1.570796326734125614166259765625L) - k * 6.077100506303965976595549136618501506745815e-11L) -
+                    k * 2.022266248711166455795995623655170701782335e-21L) -
+                   k * 8.478427660368899643958701469157086486731714e-32L;
+        }
+
+        constexpr long double constexpr_sin(long double x)
+        {
+            if (constexpr_isnan(x) || constexpr_isinf(x))
+            {
+                return constexpr_nan();
+            }
+            int quadrant{};
+            long double const r{constexpr_reduce_quadrant(x, quadrant)};
+            return (quadrant == 0)   ? constexpr_sin_series(r)
+                   : (quadrant == 1) ? constexpr_cos_series(r)
+                   : (quadrant == 2) ? -constexpr_sin_series(r)
+                                     : -constexpr_cos_series(r);
+        }
+
+        constexpr long double constexpr_cos(long double x)
+        {
+            if (constexpr_isnan(x) || constexpr_isinf(x))
+            {
+                return constexpr_nan();
+            }
+            int quadrant{};
+            long double const r{constexpr_reduce_quadrant(x, quadrant)};
+            return (quadrant == 0)   ? constexpr_cos_series(r)
+                   : (quadrant == 1) ? -constexpr_sin_series(r)
+                   : (quadrant == 2) ? -constexpr_cos_series(r)
+                                     : constexpr_sin_series(r);
+        }
+
+        constexpr long double constexpr_tan(long double x)
+        {
+            if (constexpr_isnan(x) || constexpr_isinf(x))
+            {
+                return constexpr_nan();
+            }
+            int quadrant{};
+            long double const r{constexpr_reduce_quadrant(x, quadrant)};
+            return (quadrant % 2 == 0) ? constexpr_sin_series(r) / constexpr_cos_series(r)
+                                       : -constexpr_cos_series(r) / constexpr_sin_series(r);
+        }
+
+        /* atan(x) for x in [0, 1]: atan(x) = π/6 + atan((x√3 - 1) / (x + √3)) above tan(π/12) */
+        constexpr long double constexpr_atan_reduced(long double x)
+        {
+            long double const t{(x <= 0.267949192431122706472553658494127633L)
+                                    ? x
+                                    : (x * constexpr_sqrt3() - 1) / (x + constexpr_sqrt3())};
+            long double power{t};
+            long double res{t};
+            for (int n = 1; n < 40; ++n)
+            {
+                power = -power * t * t;
+                long double const term{power / (2 * n + 1)};
+                if (res + term == res)
+                {
+                    break;
+                }
+                res += term;
+            }
+            return (x <= 0.267949192431122706472553658494127633L) ? res : constexpr_pi() / 6 + res;
+        }
+
+        constexpr long double constexpr_atan(long double x)
+        {
+            if (constexpr_isnan(x))
+            {
+                return x;
+            }
+            long double const a{constexpr_abs(x)};
+            long double const res{(a <= 1)                ? constexpr_atan_reduced(a)
+                                  : constexpr_isinf(a) ? constexpr_pi() / 2
+                                                       : constexpr_pi() / 2 - constexpr_atan_reduced(1 / a)};
+            return (x < 0) ? -res : res;
+        }
+
+        /* Quadrant-aware atan(y / x), the ratio of the smaller to the larger magnitude never overflows */
+        constexpr long double constexpr_atan2(long double y, long double x)
+        {
+            if (constexpr_isnan(x) || constexpr_isnan(y))
+            {
+                return constexpr_nan();
+            }
+            long double const ax{constexpr_abs(x)};
+            long double const ay{constexpr_abs(y)};
+            long double res{};
+            if (constexpr_isinf(ax) && constexpr_isinf(ay))
+            {
+                res = constexpr_pi() / 4;
+            }
+            else if (ay > ax)
+            {
+                res = constexpr_pi() / 2 - (constexpr_isinf(ay) ? 0 : constexpr_atan_reduced(ax / ay));
+            }
+            else if (ax != 0)
+            {
+                res = constexpr_isinf(ax) ? 0 : constexpr_atan_reduced(ay / ax);
+            }
+            res = (x < 0) ? constexpr_pi() - res : res;
+            return (y < 0) ? -res : res;
+        }
+
+        /* asin and acos by atan2, (1 - x)(1 + x) keeps 1 - x^2 accurate near |x| = 1 */
+        constexpr long double constexpr_asin(long double x)
+        {
+            return (constexpr_abs(x) > 1) ? constexpr_nan() : constexpr_atan2(x, constexpr_sqrt((1 - x) * (1 + x)));
+        }
+
+        constexpr long double constexpr_acos(long double x)
+        {
+            return (constexpr_abs(x) > 1) ? constexpr_nan() : constexpr_atan2(constexpr_sqrt((1 - x) * (1 + x)), x);
+        }
+
+        /* exp(a) / 2 without overflow for a up to the largest argument of sinh and cosh */
+        constexpr long double constexpr_half_exp(long double a)
+        {
+            return (a < constexpr_max_log() - 1) ? constexpr_exp(a) / 2 : constexpr_exp(a - constexpr_ln2());
+        }
+
+        /* sinh by its Taylor series below 1, where exp(x) - exp(-x) cancels */
+        constexpr long double constexpr_sinh(long double x)
+        {
+            if (constexpr_isnan(x) || constexpr_isinf(x))
+            {
+                return x;
+            }
+            long double const a{constexpr_abs(x)};
+            long double res{};
+            if (a < 1)
+            {
+                long double term{a};
+                res = a;
+                for (int n = 1; n < 16 && res + term != res; ++n)
+                {
+                    term = term * a * a / ((2 * n) * (2 * n + 1));
+                    res += term;
+                }
+            }
+            else
+            {
+                res = (a < 64) ? (constexpr_exp(a) - 1 / constexpr_exp(a)) / 2 : constexpr_half_exp(a);
+            }
+            return (x < 0) ? -res : res;
+        }
+
+        constexpr long double constexpr_cosh(long double x)
+        {
+            if (constexpr_isnan(x))
+            {
+                return x;
+            }
+            long double const a{constexpr_abs(x)};
+            return (a < 64) ? (constexpr_exp(a) + 1 / constexpr_exp(a)) / 2 : constexpr_half_exp(a);
+        }
+
+        constexpr long double constexpr_tanh(long double x)
+        {
+            if (constexpr_isnan(x))
+            {
+                return x;
+            }
+            long double const res{(constexpr_abs(x) > 40) ? 1 : constexpr_sinh(constexpr_abs(x)) / constexpr_cosh(x)};
+            return (x < 0) ? -res : res;
+        }
+
+        /* asinh(a) = log1p(a + a^2 / (1 + sqrt(1 + a^2))), log(a) + ln2 when a^2 + 1 rounds to a^2 */
+        constexpr long double constexpr_asinh(long double x)
+        {
+            if (constexpr_isnan(x) || constexpr_isinf(x))
+            {
+                return x;
+            }
+            long double const a{constexpr_abs(x)};
+            long double const res{(a > 4294967296.0L) ? constexpr_log(a) + constexpr_ln2()
+                                                      : constexpr_log1p(a + a * a / (1 + constexpr_sqrt(1 + a * a)))};
+            return (x < 0) ? -res : res;
+        }
+
+        /* acosh(x) = log1p(t + sqrt(t * (t + 2))), where t = x - 1 is exact near 1 */
+        constexpr long double constexpr_acosh(long double x)
+        {
+            if (constexpr_isnan(x) || x < 1)
+            {
+                return constexpr_nan();
+            }
+            if (constexpr_isinf(x))
+            {
+                return x;
+            }
+            return (x > 4294967296.0L) ? constexpr_log(x) + constexpr_ln2()
+                                       : constexpr_log1p((x - 1) + constexpr_sqrt((x - 1) * (x + 1)));
+        }
+
+        /* atanh(x) = log1p(2a / (1 - a)) / 2 */
+        constexpr long double constexpr_atanh(long double x)
+        {
+            if (constexpr_isnan(x) || constexpr_abs(x) > 1)
+            {
+                return constexpr_nan();
+            }
+            long double const a{constexpr_abs(x)};
+            long double const res{(a == 1) ? constexpr_inf() : constexpr_log1p(2 * a / (1 - a)) / 2};
+            return (x < 0) ? -res : res;
+        }
+
+        /* Positive base: small integer exponents by squaring, otherwise exp(y * log(x)) */
+        constexpr long double constexpr_pow_positive(long double x, long double y)
+        {
+            long double const exponent{y * constexpr_log(x)};
+            if (exponent >= constexpr_max_log())
+            {
+                return constexpr_inf();
+            }
+            if (exponent < constexpr_min_log())
+            {
+                return 0;
+            }
+            if (constexpr_trunc(y) == y && constexpr_abs(y) <= 64 && constexpr_abs(exponent) < constexpr_max_log() / 2)
+            {
+                long double res{1};
+                long double power{x};
+                for (long n = static_cast<long>(constexpr_abs(y)); n > 0; n /= 2)
+                {
+                    res = (n % 2 != 0) ? res * power : res;
+                    power = (n > 1) ? power * power : power;
+                }
+                return (y < 0) ? 1 / res : res;
+            }
+            return constexpr_exp(exponent);
+        }
+
+        /* It follows the special cases of std::pow, except the sign of the zeros */
+        constexpr long double constexpr_pow(long double x, long double y)
+        {
+            if (y == 0 || x == 1)
+            {
+                return 1;
+            }
+            if (constexpr_isnan(x) || constexpr_isnan(y))
+            {
+                return constexpr_nan();
+            }
+            if (constexpr_isinf(y))
+            {
+                return (constexpr_abs(x) == 1) ? 1 : (((constexpr_abs(x) > 1) == (y > 0)) ? constexpr_inf() : 0);
+            }
+            bool const integral{constexpr_trunc(y) == y};
+            bool const odd{integral && constexpr_fmod(y, 2) != 0};
+            if (x == 0)
+            {
+                return (y > 0) ? 0 : constexpr_inf();
+            }
+            if (constexpr_isinf(x))
+            {
+                return (y < 0) ? 0 : ((x < 0 && odd) ? -constexpr_inf() : constexpr_inf());
+            }
+            if (x < 0)
+            {
+                return !integral ? constexpr_nan()
+                                 : (odd ? -constexpr_pow_positive(-x, y) : constexpr_pow_positive(-x, y));
+            }
+            return constexpr_pow_positive(x, y);
+        }
+
+        /* hypot(x, y) scaled by the larger magnitude */
+        constexpr long double constexpr_hypot(long double x, long double y)
+        {
+            long double const ax{constexpr_abs(x)};
+            long double const ay{constexpr_abs(y)};
+            long double const larger{(ax > ay) ? ax : ay};
+            long double const smaller{(ax > ay) ? ay : ax};
+            return (constexpr_isinf(larger) || larger == 0)
+                       ? larger
+                       : larger * constexpr_sqrt(1 + (smaller / larger) * (smaller / larger));
+        }
+
+        namespace math
+        {
+            /*
+             * Math function of a TY value: the constexpr implementation in constant expressions,
+             * the <cmath> function at run time.
+             */
+#define STU_DEF_CONSTEXPR_MATH(function)                                                    \
+    template <typename TY>                                                                  \
+    constexpr TY function(TY value)                                                         \
+    {                                                                                       \
+        return STU_CONSTANT_EVALUATED() ? constexpr_narrow<TY>(constexpr_##function(value)) \
+                                        : std::function(value);                             \
+    }
+
+            STU_DEF_CONSTEXPR_MATH(abs)
+            STU_DEF_CONSTEXPR_MATH(ceil)
+            STU_DEF_CONSTEXPR_MATH(floor)
+            STU_DEF_CONSTEXPR_MATH(round)
+            STU_DEF_CONSTEXPR_MATH(sqrt)
+            STU_DEF_CONSTEXPR_MATH(cbrt)
+            STU_DEF_CONSTEXPR_MATH(exp)
+            STU_DEF_CONSTEXPR_MATH(log)
+            STU_DEF_CONSTEXPR_MATH(log10)
+            STU_DEF_CONSTEXPR_MATH(sin)
+            STU_DEF_CONSTEXPR_MATH(cos)
+            STU_DEF_CONSTEXPR_MATH(tan)
+            STU_DEF_CONSTEXPR_MATH(asin)
+            STU_DEF_CONSTEXPR_MATH(acos)
+            STU_DEF_CONSTEXPR_MATH(atan)
+            STU_DEF_CONSTEXPR_MATH(sinh)
+            STU_DEF_CONSTEXPR_MATH(cosh)
+            STU_DEF_CONSTEXPR_MATH(tanh)
+            STU_DEF_CONSTEXPR_MATH(asinh)
+            STU_DEF_CONSTEXPR_MATH(acosh)
+            STU_DEF_CONSTEXPR_MATH(atanh)
+
+#undef STU_DEF_CONSTEXPR_MATH
+
+            template <typename TY>
+            constexpr TY pow(TY base, TY exponent)
+            {
+                return STU_CONSTANT_EVALUATED() ? constexpr_narrow<TY>(constexpr_pow(base, exponent))
+                                                : std::pow(base, exponent);
+            }
+
+            template <typename TY>
+            constexpr TY atan2(TY y, TY x)
+            {
+                return STU_CONSTANT_EVALUATED() ? constexpr_narrow<TY>(constexpr_atan2(y, x)) : std::atan2(y, x);
+            }
+
+            template <typename TY>
+            constexpr TY fmod(TY dividend, TY divisor)
+            {
+                return STU_CONSTANT_EVALUATED() ? constexpr_narrow<TY>(constexpr_fmod(dividend, divisor))
+                                                : std::fmod(dividend, divisor);
+            }
+
+            template <typename TY>
+            constexpr TY hypot(TY x, TY y)
+            {
+                return STU_CONSTANT_EVALUATED() ? constexpr_narrow<TY>(constexpr_hypot(x, y)) : std::hypot(x, y);
+            }
+        } // namespace math
+    } // namespace utils
+    ///@endcond
+} // namespace stu
+
+#endif // STRONGUNITCONSTEXPRMATH_H
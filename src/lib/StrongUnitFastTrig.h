@@ -0,0 +1,333 @@
+/**
+ * @file StrongUnitFastTrig.h
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Strong Unit table-driven angle functions at configurable precision
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STRONGUNITFASTTRIG_H
+#define STRONGUNITFASTTRIG_H
+
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include "StrongUnit.h"
+
+namespace stu
+{
+    /// @cond
+    namespace utils /* Lookup tables of the fast angle functions */
+    {
+        constexpr long double fast_pi() { return 3.14159265358979323846264338327950288L; }
+
+        constexpr unsigned long long fast_pow10(unsigned digits)
+        {
+            return (digits == 0) ? 1ULL : 10ULL * fast_pow10(digits - 1);
+        }
+
+        /*
+         * Smallest power of two N such that the linear interpolation of sin over N intervals per turn
+         * has an error below 10^-digits: (2π/N)^2 / 8 <= 10^-digits, i.e. N^2 >= 4.935 * 10^digits.
+         */
+        constexpr std::size_t fast_sin_table_size(unsigned digits, std::size_t size = 16)
+        {
+            return (size * size * 1000ULL >= 4935ULL * fast_pow10(digits)) ? size : fast_sin_table_size(digits, 2 * size);
+        }
+
+        /*
+         * Smallest power of two M such that the linear interpolation of atan over M intervals of [0, 1]
+         * has an error below 10^-digits: max|atan''| / (8 M^2) <= 10^-digits, with max|atan''| = 0.6496.
+         */
+        constexpr std::size_t fast_atan_table_size(unsigned digits, std::size_t size = 16)
+        {
+            return (size * size * 10000ULL >= 812ULL * fast_pow10(digits)) ? size : fast_atan_table_size(digits, 2 * size);
+        }
+
+        /* Taylor series of sin and cos, |x| <= π/4 */
+        constexpr long double fast_sin_series(long double x)
+        {
+            long double term{x};
+            long double res{x};
+            for (int n = 1; n < 12; ++n)
+            {
+                term = -term * x * x / ((2 * n) * (2 * n + 1));
+                res += term;
+            }
+            return res;
+        }
+
+        constexpr long double fast_cos_series(long double x)
+        {
+            long double term{1};
+            long double res{1};
+            for (int n = 1; n < 12; ++n)
+            {
+                term = -term * x * x / ((2 * n - 1) * (2 * n));
+                res += term;
+            }
+            return res;
+        }
+
+        /* Taylor series of atan, |x| <= 1/2 (|x| <= 1/3 when called by fast_atan) */
+        constexpr long double fast_atan_series(long double x)
+        {
+            long double power{x};
+            long double res{x};
+            for (int n = 1; n < 32; ++n)
+            {
+                power = -power * x * x;
+                res += power / (2 * n + 1);
+            }
+            return res;
+        }
+
+        /* atan(x) for x in [0, 1]: atan(x) = π/4 + atan((x - 1) / (x + 1)) above 1/2 */
+        constexpr long double fast_atan(long double x)
+        {
+            return (x <= 0.5L) ? fast_atan_series(x) : fast_pi() / 4 + fast_atan_series((x - 1) / (x + 1));
+        }
+
+        /*
+         * sin(2π k / SIZE) for k in [0, SIZE]: every value is evaluated from an angle in [0, π/4] by the
+         * quadrant and octant symmetries, so the table is exact to double rounding.
+         */
+        template <std::size_t SIZE>
+        struct fast_sin_table
+        {
+            double values_[SIZE + 1];
+
+            constexpr fast_sin_table() : values_{}
+            {
+                for (std::size_t k = 0; k <= SIZE / 4; ++k)
+                {
+                    long double const value{(8 * k <= SIZE) ? fast_sin_series(2 * fast_pi() * k / SIZE)
+                                                            : fast_cos_series(2 * fast_pi() * (SIZE / 4 - k) / SIZE)};
+                    values_[k] = static_cast<double>(value);
+                    values_[SIZE / 2 - k] = static_cast<double>(value);
+                    values_[SIZE / 2 + k] = static_cast<double>(-value);
+                    values_[SIZE - k] = static_cast<double>(-value);
+                }
+            }
+        };
+
+        /* atan(k / SIZE) for k in [0, SIZE] */
+        template <std::size_t SIZE>
+        struct fast_atan_table
+        {
+            double values_[SIZE + 1];
+
+            constexpr fast_atan_table() : values_{}
+            {
+                for (std::size_t k = 0; k <= SIZE; ++k)
+                    values_[k] = static_cast<double>(fast_atan(static_cast<long double>(k) / SIZE));
+            }
+        };
+
+        /*
+         * Tables of a precision: constant initialized read-only data, safely shared by all the threads
+         * (no lazy initialization, no guard).
+         */
+        template <unsigned DIGITS>
+        struct fast_trig_tables
+        {
+            static_assert(DIGITS >= 1 && DIGITS <= 7, "==>> FAST ANGLE FUNCTIONS DIGITS MUST BE IN [1, 7]! <<==");
+
+            static constexpr std::size_t sin_size{fast_sin_table_size(DIGITS)};
+            static constexpr std::size_t atan_size{fast_atan_table_size(DIGITS)};
+            static constexpr fast_sin_table<sin_size> sin_{};
+            static constexpr fast_atan_table<atan_size> atan_{};
+        };
+
+#ifndef __cpp_inline_variables
+        template <unsigned DIGITS>
+        constexpr std::size_t fast_trig_tables<DIGITS>::sin_size;
+        template <unsigned DIGITS>
+        constexpr std::size_t fast_trig_tables<DIGITS>::atan_size;
+        template <unsigned DIGITS>
+        constexpr fast_sin_table<fast_trig_tables<DIGITS>::sin_size> fast_trig_tables<DIGITS>::sin_;
+        template <unsigned DIGITS>
+        constexpr fast_atan_table<fast_trig_tables<DIGITS>::atan_size> fast_trig_tables<DIGITS>::atan_;
+#endif
+
+        /* sin of an angle expressed in turns, by linear interpolation of the table (NaN for non-finite angles) */
+        template <unsigned DIGITS>
+        double fast_sin_turns(double turns)
+        {
+            using tables = fast_trig_tables<DIGITS>;
+            double const fraction{turns - std::floor(turns)};
+            if (!(fraction >= 0.0))
+                return std::numeric_limits<double>::quiet_NaN();
+            double const position{fraction * tables::sin_size};
+            // fraction may round up to 1.0 for tiny negative turns
+            std::size_t const index{static_cast<std::size_t>(position) < tables::sin_size ? static_cast<std::size_t>(position)
+                                                                                            : tables::sin_size - 1};
+            double const low{tables::sin_.values_[index]};
+            return low + (position - static_cast<double>(index)) * (tables::sin_.values_[index + 1] - low);
+        }
+
+        /* atan2 by octant reduction to atan(min/max), interpolated in the table */
+        template <unsigned DIGITS>
+        double fast_atan2(double y, double x)
+        {
+            using tables = fast_trig_tables<DIGITS>;
+            double const ax{std::fabs(x)};
+            double const ay{std::fabs(y)};
+            double const high{(ax < ay) ? ay : ax};
+            double const low{(ax < ay) ? ax : ay};
+            double ratio{(high > 0.0) ? low / high : 0.0};
+            if (std::isinf(high))
+                ratio = std::isinf(low) ? 1.0 : 0.0;
+            if (!(ratio >= 0.0))
+                return std::numeric_limits<double>::quiet_NaN();
+            double const position{ratio * tables::atan_size};
+            std::size_t const index{static_cast<std::size_t>(position) < tables::atan_size ? static_cast<std::size_t>(position)
+                                                                                             : tables::atan_size - 1};
+            double const base{tables::atan_.values_[index]};
+            double res{base + (position - static_cast<double>(index)) * (tables::atan_.values_[index + 1] - base)};
+            if (ay > ax)
+                res = static_cast<double>(fast_pi() / 2) - res;
+            if (std::signbit(x))
+                res = static_cast<double>(fast_pi()) - res;
+            return std::signbit(y) ? -res : res;
+        }
+    } // namespace utils
+    ///@endcond
+
+    /**
+     * @brief
+     * Namespace of the table-driven angle functions: `sin`, `cos` and `atan2` with an absolute error below
+     * `10^-DIGITS` (DIGITS in [1, 7], 6 by default), by linear interpolation of tables generated at
+     * compile time. The tables of a precision take `8 * (N + M + 2)` bytes, with N (intervals per turn)
+     * and M (intervals of atan on [0, 1]) the smallest powers of two meeting the error bound, e.g.
+     * N = 4096 and M = 512 for 6 digits.
+     * @note Non-finite angles yield NaN. The accuracy is absolute and it does not improve near zero;
+     *       angles are reduced in turns, so very large angles lose precision as with any double reduction.
+     */
+    namespace fast
+    {
+        /**
+         * @brief It returns sin(angle) of a radian angle.
+         */
+        template <unsigned DIGITS = 6, typename TY, typename LA>
+        stu::numeral_unit<TY> sin(stu::numeral_rad<TY, LA> const &angle)
+        {
+            return stu::numeral_unit<TY>{static_cast<TY>(
+                utils::fast_sin_turns<DIGITS>(angle() * static_cast<double>(0.5L / utils::fast_pi())))};
+        }
+
+        /**
+         * @brief It returns cos(angle) of a radian angle.
+         */
+        template <unsigned DIGITS = 6, typename TY, typename LA>
+        stu::numeral_unit<TY> cos(stu::numeral_rad<TY, LA> const &angle)
+        {
+            return stu::numeral_unit<TY>{static_cast<TY>(
+                utils::fast_sin_turns<DIGITS>(angle() * static_cast<double>(0.5L / utils::fast_pi()) + 0.25))};
+        }
+
+        /**
+         * @brief It returns sin(angle) of a degree angle.
+         */
+        template <unsigned DIGITS = 6, typename TY, typename LA>
+        stu::numeral_unit<TY> sin(stu::numeral_deg<TY, LA> const &angle)
+        {
+            return stu::numeral_unit<TY>{static_cast<TY>(utils::fast_sin_turns<DIGITS>(angle() / 360.0))};
+        }
+
+        /**
+         * @brief It returns cos(angle) of a degree angle.
+         */
+        template <unsigned DIGITS = 6, typename TY, typename LA>
+        stu::numeral_unit<TY> cos(stu::numeral_deg<TY, LA> const &angle)
+        {
+            return stu::numeral_unit<TY>{static_cast<TY>(utils::fast_sin_turns<DIGITS>(angle() / 360.0 + 0.25))};
+        }
+
+        /**
+         * @brief It returns the radian angle of the point (x, y), in [-π, π], of two units of the same quantity.
+         */
+        template <unsigned DIGITS = 6, typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
+        stu::numeral_rad<TY> atan2(Unit<TY, QU, SC1, LA1> const &y, Unit<TY, QU, SC2, LA2> const &x)
+        {
+            STU_ASSERT_NO_CONVERSION(SC2, SC1);
+            return stu::numeral_rad<TY>{static_cast<TY>(
+                utils::fast_atan2<DIGITS>(y(), static_cast<Unit<TY, QU, SC1, LA1>>(x)()))};
+        }
+
+        /**
+         * @brief It computes `out[i] = sin(in[i])` for `size` radian angles.
+         */
+        template <unsigned DIGITS = 6, typename TY, typename LA>
+        void sin(stu::numeral_rad<TY, LA> const *in, stu::numeral_unit<TY> *out, std::size_t size)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+                out[i] = fast::sin<DIGITS>(in[i]);
+        }
+
+        /**
+         * @brief It computes `out[i] = cos(in[i])` for `size` radian angles.
+         */
+        template <unsigned DIGITS = 6, typename TY, typename LA>
+        void cos(stu::numeral_rad<TY, LA> const *in, stu::numeral_unit<TY> *out, std::size_t size)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+                out[i] = fast::cos<DIGITS>(in[i]);
+        }
+
+        /**
+         * @brief It computes `out[i] = sin(in[i])` for `size` degree angles.
+         */
+        template <unsigned DIGITS = 6, typename TY, typename LA>
+        void sin(stu::numeral_deg<TY, LA> const *in, stu::numeral_unit<TY> *out, std::size_t size)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+                out[i] = fast::sin<DIGITS>(in[i]);
+        }
+
+        /**
+         * @brief It computes `out[i] = cos(in[i])` for `size` degree angles.
+         */
+        template <unsigned DIGITS = 6, typename TY, typename LA>
+        void cos(stu::numeral_deg<TY, LA> const *in, stu::numeral_unit<TY> *out, std::size_t size)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+                out[i] = fast::cos<DIGITS>(in[i]);
+        }
+
+        /**
+         * @brief It computes `out[i] = atan2(y[i], x[i])` for `size` points.
+         */
+        template <unsigned DIGITS = 6, typename TY, typename QU, typename SC1, typename SC2, typename LA1, typename LA2>
+        void atan2(Unit<TY, QU, SC1, LA1> const *y, Unit<TY, QU, SC2, LA2> const *x, stu::numeral_rad<TY> *out,
+                   std::size_t size)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+                out[i] = fast::atan2<DIGITS>(y[i], x[i]);
+        }
+    } // namespace fast
+
+} // namespace stu
+
+#endif // STRONGUNITFASTTRIG_H
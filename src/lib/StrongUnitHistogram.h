@@ -0,0 +1,196 @@
+/**
+ * @file StrongUnitHistogram.h
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Strong Unit histogram with logarithmic buckets
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STRONGUNITHISTOGRAM_H
+#define STRONGUNITHISTOGRAM_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include "StrongUnit.h"
+
+namespace stu
+{
+    /**
+     * @brief
+     * Class template representing a histogram of strong unit values (e.g. latencies in seconds)
+     * with logarithmic buckets, HDR style: every power of two in [2^MIN_EXPONENT, 2^MAX_EXPONENT)
+     * is split in 2^PRECISION_BITS linear buckets, so a percentile has a relative error below
+     * 2^-(PRECISION_BITS+1) and recording is O(1), with no allocation and no call to log().
+     * Values of other units of the same quantity (e.g. milliseconds) are converted to `UNIT` on insert
+     * and percentiles are returned as `UNIT`.
+     * @note Recording is not thread safe: use one histogram per thread and `merge` them.
+     *       Values below 2^MIN_EXPONENT (zero and negative values too) are counted in the lowest bucket,
+     *       values above 2^MAX_EXPONENT in the highest one, NaN is ignored.
+     * @tparam UNIT             strong unit of the recorded values (e.g. second)
+     * @tparam PRECISION_BITS   number of mantissa bits of the bucket index
+     * @tparam MIN_EXPONENT     binary exponent of the lowest bucket in `UNIT`
+     * @tparam MAX_EXPONENT     binary exponent of the highest bucket bound in `UNIT`
+     */
+    template <typename UNIT, unsigned PRECISION_BITS = 6U, int MIN_EXPONENT = -32, int MAX_EXPONENT = 32>
+    class Histogram final
+    {
+        static_assert(PRECISION_BITS <= 16U, "==>> HISTOGRAM PRECISION MUST BE AT MOST 16 BITS! <<==");
+        static_assert(MIN_EXPONENT < MAX_EXPONENT && MIN_EXPONENT > -1022 && MAX_EXPONENT < 1023,
+                      "==>> HISTOGRAM EXPONENT RANGE NOT ALLOWED! <<==");
+
+    public:
+        using unit = UNIT;
+        using type = typename UNIT::type;
+        using quantity = typename UNIT::quantity;
+        using scale = typename UNIT::scale;
+        using label = typename UNIT::label;
+
+        static constexpr std::size_t sub_buckets_ = std::size_t{1} << PRECISION_BITS;
+        static constexpr std::size_t buckets_ = static_cast<std::size_t>(MAX_EXPONENT - MIN_EXPONENT) * sub_buckets_;
+
+    private:
+        std::uint64_t counts_[buckets_]{};
+        std::uint64_t count_{0};
+        double sum_{0.0};
+        double min_{std::numeric_limits<double>::infinity()};
+        double max_{-std::numeric_limits<double>::infinity()};
+
+        /*
+         * Bucket of a value: its binary exponent and the PRECISION_BITS most significant mantissa bits,
+         * read from the IEEE double representation.
+         */
+        static std::size_t bucket_index(double value)
+        {
+            if (!(value >= std::ldexp(1.0, MIN_EXPONENT)))
+                return 0U;
+            if (value >= std::ldexp(1.0, MAX_EXPONENT))
+                return buckets_ - 1U;
+
+            std::uint64_t bits;
+            std::memcpy(&bits, &value, sizeof bits);
+            auto const exponent = static_cast<std::int64_t>(bits >> 52) - 1023 - MIN_EXPONENT;
+            auto const mantissa = (bits >> (52U - PRECISION_BITS)) & (sub_buckets_ - 1U);
+            return static_cast<std::size_t>(exponent) * sub_buckets_ + static_cast<std::size_t>(mantissa);
+        }
+
+        /*
+         * Midpoint of a bucket, i.e. the value with the least relative error for all the values of the bucket.
+         */
+        static double bucket_value(std::size_t index)
+        {
+            auto const exponent = static_cast<int>(index / sub_buckets_) + MIN_EXPONENT;
+            auto const mantissa = static_cast<double>(index % sub_buckets_) + 0.5;
+            return std::ldexp(1.0 + mantissa / static_cast<double>(sub_buckets_), exponent);
+        }
+
+    public:
+        Histogram() = default;
+        Histogram(Histogram const &other) = default;
+        Histogram &operator=(Histogram const &other) = default;
+        ~Histogram() = default;
+
+        /**
+         * @brief It records `count` occurrences of `value` (converted to `UNIT`).
+         */
+        template <typename OTHER_SCALE, typename OTHER_LABEL>
+        void record(Unit<type, quantity, OTHER_SCALE, OTHER_LABEL> const &value, std::uint64_t count = 1U)
+        {
+            auto const converted = static_cast<double>(static_cast<UNIT>(value)());
+            if (std::isnan(converted))
+                return;
+
+            counts_[bucket_index(converted)] += count;
+            count_ += count;
+            sum_ += converted * static_cast<double>(count);
+            min_ = (converted < min_) ? converted : min_;
+            max_ = (converted > max_) ? converted : max_;
+        }
+
+        /**
+         * @brief It adds the counts of `other`, e.g. the histogram recorded by another thread.
+         */
+        void merge(Histogram const &other)
+        {
+            for (std::size_t i = 0; i < buckets_; ++i)
+                counts_[i] += other.counts_[i];
+            count_ += other.count_;
+            sum_ += other.sum_;
+            min_ = (other.min_ < min_) ? other.min_ : min_;
+            max_ = (other.max_ > max_) ? other.max_ : max_;
+        }
+
+        void reset()
+        {
+            *this = Histogram{};
+        }
+
+        std::uint64_t count() const { return count_; }
+
+        UNIT min() const { return UNIT{static_cast<type>(count_ ? min_ : 0.0)}; }
+
+        UNIT max() const { return UNIT{static_cast<type>(count_ ? max_ : 0.0)}; }
+
+        UNIT mean() const { return UNIT{static_cast<type>(count_ ? sum_ / static_cast<double>(count_) : 0.0)}; }
+
+        /**
+         * @brief It returns the value below which `percentile` percent of the recorded values fall.
+         * @param percentile in [0, 100], e.g. 99.9
+         * @return the midpoint of the bucket holding that rank, clamped to the recorded minimum and maximum
+         *         (the exact minimum and maximum for the 0th and 100th percentiles)
+         */
+        UNIT percentile(double percentile) const
+        {
+            if (count_ == 0U)
+                return UNIT{};
+
+            double const clamped = (percentile < 0.0) ? 0.0 : ((percentile > 100.0) ? 100.0 : percentile);
+            auto const rank = static_cast<std::uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(count_)));
+            if (rank == 0U)
+                return min();
+            if (rank >= count_)
+                return max();
+
+            std::uint64_t cumulative{0};
+            std::size_t index{0};
+            for (; index < buckets_ - 1U; ++index)
+            {
+                cumulative += counts_[index];
+                if (cumulative >= rank)
+                    break;
+            }
+
+            double value = bucket_value(index);
+            value = (value < min_) ? min_ : value;
+            value = (value > max_) ? max_ : value;
+            return UNIT{static_cast<type>(value)};
+        }
+
+    }; // Histogram
+
+} // namespace stu
+
+#endif // STRONGUNITHISTOGRAM_H
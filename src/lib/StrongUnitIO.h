@@ -0,0 +1,176 @@
+/**
+ * @file StrongUnitIO.h
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Strong Unit iostream support (labels, printing and streaming)
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STRONGUNITIO_H
+#define STRONGUNITIO_H
+
+#include <string>
+#include <iostream>
+#include "StrongUnit.h"
+#include "StrongAffineUnit.h"
+
+namespace stu
+{
+    /// @cond
+    namespace utils /* Utilities to compose unit labels */
+    {
+        template <typename LA>
+        std::string label_string(LA const &)
+        {
+            return LA::name();
+        }
+
+        template <std::size_t index>
+        std::string base_label_string()
+        {
+            return (tag::base_label<index>::name() == nullptr) ? "b" + std::to_string(index)
+                                                              : std::string{tag::base_label<index>::name()};
+        }
+
+        /*
+         * It appends the factor base^EXP to a derived label, e.g. "_m" and "_s^-1" give "_m*_s^-1".
+         */
+        template <std::size_t index, typename EXP>
+        std::string append_factor(std::string const &res)
+        {
+            if (EXP::num == 0)
+                return res;
+            std::string fac{base_label_string<index>()};
+            if (EXP::num != 1 || EXP::den != 1)
+                fac += "^" + std::to_string(EXP::num) + ((EXP::den == 1) ? "" : "/" + std::to_string(EXP::den));
+            return res.empty() ? fac : res + "*" + fac;
+        }
+
+        template <typename QU>
+        std::string label_string(tag::derived_label<QU> const &)
+        {
+            std::string res;
+            res = append_factor<0, typename QU::b0e>(res);
+            res = append_factor<1, typename QU::b1e>(res);
+            res = append_factor<2, typename QU::b2e>(res);
+            res = append_factor<3, typename QU::b3e>(res);
+            res = append_factor<4, typename QU::b4e>(res);
+            res = append_factor<5, typename QU::b5e>(res);
+            res = append_factor<6, typename QU::b6e>(res);
+            res = append_factor<7, typename QU::b7e>(res);
+            res = append_factor<8, typename QU::b8e>(res);
+            res = append_factor<9, typename QU::b9e>(res);
+            return res.empty() ? "u_" : res;
+        }
+    } // namespace utils
+    ///@endcond
+
+    /**
+     * @brief It returns the label of a unit, e.g. "_m" (or "_m*_s^-1" for unnamed derived units).
+     */
+    template <typename TY, typename QU, typename SC, typename LA>
+    std::string label(Unit<TY, QU, SC, LA> const &)
+    {
+        return utils::label_string(LA{});
+    }
+
+    /**
+     * @brief It streams out the value of a unit.
+     */
+    template <typename TY, typename QU, typename SC, typename LA>
+    std::ostream &operator<<(std::ostream &os, Unit<TY, QU, SC, LA> const &a_unit)
+    {
+        os << a_unit() << "*" << stu::label(a_unit);
+        return os;
+    }
+
+    /**
+     * @brief It streams in a numeric value to a unit.
+     * @note It throws an instance of `std::invalid_argument` if the argument is not a number.
+     */
+    template <typename TY, typename QU, typename SC, typename LA>
+    std::istream &operator>>(std::istream &is, Unit<TY, QU, SC, LA> &a_unit)
+    {
+        std::string data;
+        is >> data;
+        if (data.empty())
+            is.setstate(std::ios::failbit);
+        else
+            a_unit = Unit<TY, QU, SC, LA>{static_cast<TY>(std::stold(data))};
+        return is;
+    }
+
+    /**
+     * @brief Prints a unit information.
+     * It streams value, quantity, and scale information to the standard output.
+     */
+    template <typename TY, typename QU, typename SC, typename LA>
+    void print_unit(Unit<TY, QU, SC, LA> const &a_unit)
+    {
+        std::cout << a_unit << " ["
+                  << "<" << QU::b0e::num << ":" << QU::b0e::den << ">"
+                  << "<" << QU::b1e::num << ":" << QU::b1e::den << ">"
+                  << "<" << QU::b2e::num << ":" << QU::b2e::den << ">"
+                  << "<" << QU::b3e::num << ":" << QU::b3e::den << ">"
+                  << "<" << QU::b4e::num << ":" << QU::b4e::den << ">"
+                  << "<" << QU::b5e::num << ":" << QU::b5e::den << ">"
+                  << "<" << QU::b6e::num << ":" << QU::b6e::den << ">"
+                  << "<" << QU::b7e::num << ":" << QU::b7e::den << ">"
+                  << "<" << QU::b8e::num << ":" << QU::b8e::den << ">"
+                  << "<" << QU::b9e::num << ":" << QU::b9e::den << ">"
+                  << " ; S=" << utils::scale_value<SC>() << "]\n";
+    }
+
+    /**
+     * @brief It returns the label of an affine unit, e.g. "_Cdeg".
+     */
+    template <typename UN, typename OR, typename LA>
+    std::string label(AffineUnit<UN, OR, LA> const &)
+    {
+        return utils::label_string(LA{});
+    }
+
+    /**
+     * @brief It streams out the value of an affine unit.
+     */
+    template <typename UN, typename OR, typename LA>
+    std::ostream &operator<<(std::ostream &os, AffineUnit<UN, OR, LA> const &a_unit)
+    {
+        os << a_unit() << "*" << stu::label(a_unit);
+        return os;
+    }
+
+    /**
+     * @brief Prints an affine unit information.
+     * It streams value, difference unit, and origin information to the standard output.
+     */
+    template <typename UN, typename OR, typename LA>
+    void print_unit(AffineUnit<UN, OR, LA> const &a_unit)
+    {
+        std::cout << a_unit << " [D=" << stu::label(UN{}) << " ; O=" << 1.0 * OR::num / OR::den << "]\n";
+    }
+
+} // namespace stu
+
+#endif // STRONGUNITIO_H
@@ -0,0 +1,828 @@
+/**
+ * @file StrongUnitVMath.h
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Batch (vectorizable) math functions over arrays of strong units
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STRONGUNITVMATH_H
+#define STRONGUNITVMATH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include "StrongUnit.h"
+#include "StrongCUnit.h"
+
+namespace stu
+{
+    /**
+     * @brief
+     * Accuracy tiers of the batch exponential, logarithmic, power and hyperbolic functions.
+     */
+    enum class accuracy
+    {
+        precise, ///< one C library call per value (e.g. glibc: < 1 ULP for exp, log and pow)
+        fast     ///< vectorizable kernels in double precision, max error < 4 ULP
+    };
+
+    /// @cond
+    /*
+     * Branch-free polynomial kernels: the loops calling them are vectorized by the compiler
+     * (e.g. GCC -O3), out of range values are computed by the C library in a separate loop.
+     */
+    namespace utils
+    {
+        /*
+         * Largest |angle| (rad) handled by the polynomial kernels, larger or non-finite angles
+         * fall back to std::sin / std::cos.
+         */
+        constexpr double trig_kernel_limit{1048576.0};
+
+        inline std::uint64_t to_bits(double value)
+        {
+            std::uint64_t res;
+            std::memcpy(&res, &value, sizeof res);
+            return res;
+        }
+
+        inline double from_bits(std::uint64_t value)
+        {
+            double res;
+            std::memcpy(&res, &value, sizeof res);
+            return res;
+        }
+
+        /*
+         * sin and cos of x (|x| <= trig_kernel_limit) evaluated in double precision, branch-free.
+         * x is reduced to r in [-π/4, π/4] by a four-term Cody-Waite reduction (the first three
+         * π/2 chunks have 24 bits, so their products are exact), then sin(r) and cos(r) are
+         * evaluated by the Cephes minimax polynomials and swapped or negated by the quadrant with
+         * bit masks. The quadrant is read from the low mantissa bits of the rounded x*2/π (no float
+         * to int conversion, so out of range and non-finite x are harmless and fixed up by the callers).
+         * Measured max error against long double: < 2.5 ULP, < 1 ULP near multiples of π/2.
+         */
+        inline void sincos_kernel(double x, double &s, double &c)
+        {
+            double const shifted{x * 0.63661977236758134308 + 6755399441055744.0};
+            std::uint64_t const quadrant{to_bits(shifted)};
+            double const y{shifted - 6755399441055744.0};
+
+            double r{x - y * 1.570796251296997};
+            r = r - y * 7.549789415861596e-08;
+            r = r - y * 5.390302529957765e-15;
+            r = r - y * 3.2820035428735005e-22;
+
+            double const z{r * r};
+            double const sr{r + r * z * (((((1.58962301576546568060E-10 * z - 2.50507477628578072866E-8) * z +
+                                            2.75573136213857245213E-6) * z - 1.98412698295895385996E-4) * z +
+                                          8.33333333332211858878E-3) * z - 1.66666666666666307295E-1)};
+            double const cr{1.0 - 0.5 * z + z * z * (((((-1.13585365213876817300E-11 * z + 2.08757008419747316778E-9) * z -
+                                                         2.75573141792967388112E-7) * z + 2.48015872888517045348E-5) * z -
+                                                       1.38888888888730564116E-3) * z + 4.16666666666665929218E-2)};
+
+            std::uint64_t const odd{0 - (quadrant & 1)};
+            std::uint64_t const sr_bits{to_bits(sr)};
+            std::uint64_t const cr_bits{to_bits(cr)};
+            s = from_bits(((cr_bits & odd) | (sr_bits & ~odd)) ^ ((quadrant & 2) << 62));
+            c = from_bits(((sr_bits & odd) | (cr_bits & ~odd)) ^ (((quadrant + 1) & 2) << 62));
+        }
+
+        inline bool in_trig_kernel_range(double x)
+        {
+            return (std::fabs(x) <= trig_kernel_limit);
+        }
+
+        template <typename TY>
+        using is_batch_type = std::integral_constant<bool, std::is_same<TY, float>::value ||
+                                                               std::is_same<TY, double>::value>;
+
+        /*
+         * Reduction of e^x to 2^n * (1 + p): n = round(x/ln2), r = x - n*ln2 (two-term ln2, the
+         * first term has 32 bits so n*ln2_hi is exact), p = e^r - 1 by its degree 13 Taylor polynomial
+         * (|r| <= ln2/2). 2^n is built from the low mantissa bits of the rounded x/ln2, so x must be
+         * in [-708, 709] and the callers fix up other values.
+         */
+        inline double exp_reduction(double x, double &two_n)
+        {
+            double const shifted{x * 1.4426950408889634074 + 6755399441055744.0};
+            two_n = from_bits((to_bits(shifted) - to_bits(6755399441055744.0) + 1023) << 52);
+            double const n{shifted - 6755399441055744.0};
+            double const r{(x - n * 6.93147180369123816490e-01) - n * 1.90821492927058770002e-10};
+
+            return r * (1.0 + r * (1.0 / 2 + r * (1.0 / 6 + r * (1.0 / 24 + r * (1.0 / 120 + r * (1.0 / 720 +
+                   r * (1.0 / 5040 + r * (1.0 / 40320 + r * (1.0 / 362880 + r * (1.0 / 3628800 +
+                   r * (1.0 / 39916800 + r * (1.0 / 479001600 + r * (1.0 / 6227020800)))))))))))));
+        }
+
+        /*
+         * Logarithm of a positive normal x = 2^k * (1 + f), sqrt(2)/2 <= 1 + f < sqrt(2), by the fdlibm
+         * (e_log.c) polynomial in s = f/(2 + f); k and f are extracted with integer operations only.
+         */
+        inline double log_kernel(double x)
+        {
+            std::uint64_t const bits{to_bits(x) + (0x3ff0000000000000ULL - 0x3fe6a09e00000000ULL)};
+            double const k{from_bits(0x4330000000000000ULL | (bits >> 52)) - (4503599627370496.0 + 1023.0)};
+            double const f{from_bits((bits & 0x000fffffffffffffULL) + 0x3fe6a09e00000000ULL) - 1.0};
+
+            double const hfsq{0.5 * f * f};
+            double const s{f / (2.0 + f)};
+            double const z{s * s};
+            double const w{z * z};
+            double const t1{w * (3.999999999940941908e-01 + w * (2.222219843214978396e-01 + w * 1.531383769920937332e-01))};
+            double const t2{z * (6.666666666666735130e-01 + w * (2.857142874366239149e-01 +
+                                                                 w * (1.818357216161805012e-01 + w * 1.479819860511658591e-01)))};
+
+            return s * (hfsq + t1 + t2) + k * 1.90821492927058770002e-10 - hfsq + f + k * 6.93147180369123816490e-01;
+        }
+
+        /*
+         * x^y for a positive normal x by the fdlibm (e_pow.c) algorithm: log2(x) and y*log2(x) are
+         * computed in extended precision (pairs of doubles split by clearing their low words), then
+         * 2^(y*log2(x)) by a rational approximation. The interval and table selections are bit masks.
+         * It returns NaN when the result is out of the normal range, so that the callers fix it up.
+         */
+        inline double pow_kernel(double x, double y)
+        {
+            std::uint64_t const low_word{0xffffffff00000000ULL};
+            std::uint64_t const hx{to_bits(x) >> 32};
+            std::uint64_t const j{hx & 0x000fffff};
+            std::uint64_t const above{j > 0x3988E};
+            std::uint64_t const next{j >= 0xBB67A};
+            std::uint64_t const k{above - next};
+            std::uint64_t const k_mask{0 - k};
+            std::uint64_t const ix{(j | 0x3ff00000) - (next << 20)};
+            double const ax{from_bits((ix << 32) | (to_bits(x) & 0xffffffffULL))};
+            double const n{from_bits(0x4330000000000000ULL | ((hx >> 20) + next)) - (4503599627370496.0 + 1023.0)};
+            double const bp{from_bits((to_bits(1.5) & k_mask) | (to_bits(1.0) & ~k_mask))};
+            double const dp_h{from_bits(to_bits(5.84962487220764160156e-01) & k_mask)};
+            double const dp_l{from_bits(to_bits(1.35003920212974897128e-08) & k_mask)};
+
+            /* log2(ax) = n + dp_h + t1 + t2 */
+            double u{ax - bp};
+            double v{1.0 / (ax + bp)};
+            double const ss{u * v};
+            double const s_h{from_bits(to_bits(ss) & low_word)};
+            double t_h{from_bits((((ix >> 1) | 0x20000000) + 0x00080000 + (k << 18)) << 32)};
+            double t_l{ax - (t_h - bp)};
+            double const s_l{v * ((u - s_h * t_h) - s_h * t_l)};
+            double s2{ss * ss};
+            double r{s2 * s2 * (5.99999999999994648725e-01 + s2 * (4.28571428578550184252e-01 +
+                     s2 * (3.33333329818377432918e-01 + s2 * (2.72728123808534006489e-01 +
+                     s2 * (2.30660745775561754067e-01 + s2 * 2.06975017800338417784e-01)))))};
+            r += s_l * (s_h + ss);
+            s2 = s_h * s_h;
+            t_h = from_bits(to_bits(3.0 + s2 + r) & low_word);
+            t_l = r - ((t_h - 3.0) - s2);
+            u = s_h * t_h;
+            v = s_l * t_h + t_l * ss;
+            double p_h{from_bits(to_bits(u + v) & low_word)};
+            double p_l{v - (p_h - u)};
+            double const z_h{9.61796700954437255859e-01 * p_h};
+            double const z_l{-7.02846165095275826516e-09 * p_h + p_l * 9.61796693925975554329e-01 + dp_l};
+            double const t1{from_bits(to_bits(((z_h + z_l) + dp_h) + n) & low_word)};
+            double const t2{z_l - (((t1 - n) - dp_h) - z_h)};
+
+            /* y*log2(ax) = p_h + p_l = m + (p_h - m) + p_l */
+            double const y1{from_bits(to_bits(y) & low_word)};
+            p_l = (y - y1) * t1 + y * t2;
+            p_h = y1 * t1;
+            double const shifted{(p_h + p_l) + 6755399441055744.0};
+            std::uint64_t const m{to_bits(shifted) - to_bits(6755399441055744.0)};
+            p_h -= shifted - 6755399441055744.0;
+
+            /* 2^(p_h + p_l) */
+            double const t{from_bits(to_bits(p_l + p_h) & low_word)};
+            u = t * 6.93147182464599609375e-01;
+            v = (p_l - (t - p_h)) * 6.93147180559945286227e-01 + t * -1.90465429995776804525e-09;
+            double z{u + v};
+            double const w{v - (z - u)};
+            double const zz{z * z};
+            double const z1{z - zz * (1.66666666666666019037e-01 + zz * (-2.77777777770155933842e-03 +
+                            zz * (6.61375632143793436117e-05 + zz * (-1.65339022054652515390e-06 +
+                            zz * 4.13813679705723846039e-08))))};
+            z = 1.0 - (((z * z1) / (z1 - 2.0) - (w + z * w)) - z);
+
+            std::uint64_t const out_of_range{0 - static_cast<std::uint64_t>(m + 1022 > 2045)};
+            return from_bits(to_bits(z * from_bits((m + 1023) << 52)) | (out_of_range & 0x7ff8000000000000ULL));
+        }
+
+        /*
+         * tanh(|x|) = expm1(2|x|) / (expm1(2|x|) + 2), with expm1 = (2^n - 1) + 2^n * p, the sign is copied back.
+         */
+        inline double tanh_kernel(double x)
+        {
+            std::uint64_t const sign{to_bits(x) & 0x8000000000000000ULL};
+            double two_n;
+            double const p{exp_reduction(2.0 * from_bits(to_bits(x) & ~0x8000000000000000ULL), two_n)};
+            double const em1{(two_n - 1.0) + two_n * p};
+
+            return from_bits(to_bits(em1 / (em1 + 2.0)) | sign);
+        }
+
+        inline bool is_positive_normal(double x)
+        {
+            return (x >= std::numeric_limits<double>::min() && x <= std::numeric_limits<double>::max());
+        }
+
+        /*
+         * Branch-free range checks of the batch functions: floating-point comparisons block the vectorization
+         * of the checking loops, so the bit patterns of x are compared as integers (their order is the order
+         * of the positive doubles). 1 when x is zero, subnormal, negative, infinite or NaN, 0 otherwise.
+         */
+        inline std::uint64_t positive_normal_overflow(double x)
+        {
+            return ((to_bits(x) - to_bits(std::numeric_limits<double>::min())) |
+                    (to_bits(std::numeric_limits<double>::max()) - to_bits(x))) >> 63;
+        }
+
+        /* 1 when |x| > limit or x is NaN, 0 otherwise */
+        inline std::uint64_t magnitude_overflow(double x, double limit)
+        {
+            return (to_bits(limit) - (to_bits(x) & ~0x8000000000000000ULL)) >> 63;
+        }
+
+        /* 1 when x is out of the trig kernel range, 0 otherwise */
+        inline std::uint64_t trig_kernel_overflow(double x)
+        {
+            return magnitude_overflow(x, trig_kernel_limit);
+        }
+
+        /* 1 when any of the angles is out of the trig kernel range, 0 otherwise */
+        template <typename TY, typename LA>
+        std::uint64_t trig_kernel_overflow(stu::numeral_rad<TY, LA> const *in, std::size_t size)
+        {
+            std::uint64_t overflow{0};
+            for (std::size_t i = 0; i < size; ++i)
+                overflow |= trig_kernel_overflow(in[i]());
+            return overflow;
+        }
+
+        /*
+         * Batch functions: fast kernel, overflow of its valid input range and precise C library function.
+         */
+        struct exp_function
+        {
+            static double fast(double x)
+            {
+                double two_n;
+                double const p{exp_reduction(x, two_n)};
+                return (1.0 + p) * two_n;
+            }
+            static std::uint64_t overflow(double x) { return magnitude_overflow(x, 708.0); }
+            template <typename TY>
+            static TY precise(TY x) { return std::exp(x); }
+        };
+
+        struct log_function
+        {
+            static double fast(double x) { return log_kernel(x); }
+            static std::uint64_t overflow(double x) { return positive_normal_overflow(x); }
+            template <typename TY>
+            static TY precise(TY x) { return std::log(x); }
+        };
+
+        struct log10_function
+        {
+            static double fast(double x) { return log_kernel(x) * 0.43429448190325182765; }
+            static std::uint64_t overflow(double x) { return positive_normal_overflow(x); }
+            template <typename TY>
+            static TY precise(TY x) { return std::log10(x); }
+        };
+
+        struct tanh_function
+        {
+            static double fast(double x) { return tanh_kernel(x); }
+            static std::uint64_t overflow(double x) { return magnitude_overflow(x, 20.0); }
+            template <typename TY>
+            static TY precise(TY x) { return std::tanh(x); }
+        };
+
+        /*
+         * Batch unary functions: one vectorized pass checks that all the values are in the fast range, then
+         * either the vectorized kernel loop or a per-value fallback loop runs, so `in` and `out` may alias.
+         */
+        template <accuracy ACCURACY, typename FUNCTION, typename TY, typename LA>
+        void batch_unary(stu::numeral_unit<TY, LA> const *in, stu::numeral_unit<TY> *out, std::size_t size)
+        {
+            static_assert(is_batch_type<TY>::value, "==>> BATCH FUNCTIONS REQUIRE float OR double UNITS! <<==");
+            if (ACCURACY == accuracy::precise)
+            {
+                for (std::size_t i = 0; i < size; ++i)
+                    out[i] = stu::numeral_unit<TY>{FUNCTION::precise(in[i]())};
+                return;
+            }
+            std::uint64_t out_of_range{0};
+            for (std::size_t i = 0; i < size; ++i)
+                out_of_range |= FUNCTION::overflow(in[i]());
+            if (out_of_range == 0)
+            {
+                for (std::size_t i = 0; i < size; ++i)
+                    out[i] = stu::numeral_unit<TY>{static_cast<TY>(FUNCTION::fast(in[i]()))};
+                return;
+            }
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                TY const x{in[i]()};
+                out[i] = stu::numeral_unit<TY>{(FUNCTION::overflow(x) == 0) ? static_cast<TY>(FUNCTION::fast(x))
+                                                                                : FUNCTION::precise(x)};
+            }
+        }
+
+        inline bool in_pow_fast_range(double base, double exponent, double result)
+        {
+            return (is_positive_normal(base) && std::fabs(exponent) <= std::numeric_limits<double>::max() &&
+                    !std::isnan(result));
+        }
+
+        /*
+         * Batch fast pow: the kernel range depends on the result, so the inputs are copied by blocks, the
+         * vectorized kernel loop runs on the copies and the out of range values are recomputed from them
+         * (`out` may alias `base` or `exponent`). The exponent is read at `exponent[i * stride]`.
+         */
+        template <typename TY, typename LA1, typename LA2>
+        void batch_pow_fast(stu::numeral_unit<TY, LA1> const *base, stu::numeral_unit<TY, LA2> const *exponent,
+                            std::size_t stride, stu::numeral_unit<TY> *out, std::size_t size)
+        {
+            constexpr std::size_t block{256};
+            double x[block], y[block];
+            for (std::size_t first = 0; first < size; first += block)
+            {
+                std::size_t const count{(size - first < block) ? size - first : block};
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    x[i] = base[first + i]();
+                    y[i] = exponent[(first + i) * stride]();
+                }
+                for (std::size_t i = 0; i < count; ++i)
+                    out[first + i] = stu::numeral_unit<TY>{static_cast<TY>(pow_kernel(x[i], y[i]))};
+                for (std::size_t i = 0; i < count; ++i)
+                    if (!in_pow_fast_range(x[i], y[i], out[first + i]()))
+                        out[first + i] = stu::numeral_unit<TY>{static_cast<TY>(std::pow(x[i], y[i]))};
+            }
+        }
+
+        /*
+         * Periods of the angle wrapping kernels: 2π is split in two terms (the first has 24 bits, so its
+         * products by the number of periods are exact below 2^29 periods), 360 degrees is exact.
+         */
+        struct radian_period
+        {
+            static constexpr double inverse() { return 0.15915494309189535; }
+            static constexpr double high() { return 6.2831854820251465; }
+            static constexpr double low() { return -1.748455600074497e-07; }
+            static constexpr double period() { return 6.283185307179586; }
+        };
+
+        struct degree_period
+        {
+            static constexpr double inverse() { return 1.0 / 360.0; }
+            static constexpr double high() { return 360.0; }
+            static constexpr double low() { return 0.0; }
+            static constexpr double period() { return 360.0; }
+        };
+
+        template <typename SC>
+        struct angle_period
+        {
+            static_assert(!std::is_same<SC, SC>::value, "==>> ANGLE WRAPPING REQUIRES RADIAN OR DEGREE UNITS! <<==");
+        };
+        template <>
+        struct angle_period<Scale<1UL, 2UL, -1>>
+        {
+            using type = radian_period;
+        };
+        template <>
+        struct angle_period<Scale<1UL, 360UL>>
+        {
+            using type = degree_period;
+        };
+
+        /* nearest integer of q (|q| < 2^51) by the 1.5 * 2^52 shift, branch-free */
+        inline double round_kernel(double q)
+        {
+            return (q + 6755399441055744.0) - 6755399441055744.0;
+        }
+
+        /*
+         * Branch-free selects of the wrapping kernels: floating-point comparisons block the if-conversion of
+         * the loops (trapping math), so the conditions are read from sign bits of exact differences and turned
+         * into masks. sign_mask(v) is all ones when v is negative, zero otherwise.
+         */
+        inline std::uint64_t sign_mask(double value)
+        {
+            return 0 - (to_bits(value) >> 63);
+        }
+
+        inline double select(std::uint64_t mask, double value)
+        {
+            return from_bits(to_bits(value) & mask);
+        }
+
+        /* 1 when |x| / period is beyond 2^29 or not finite (out of the kernel range), 0 otherwise */
+        template <typename PERIOD>
+        std::uint64_t wrap_kernel_overflow(double x)
+        {
+            return (((to_bits(x * PERIOD::inverse()) >> 52) & 0x7FF) + (2048 - (1023 + 29))) >> 11;
+        }
+
+        template <typename PERIOD>
+        bool in_wrap_kernel_range(double x)
+        {
+            return (wrap_kernel_overflow<PERIOD>(x) == 0);
+        }
+
+        /*
+         * x wrapped to [-period/2, period/2): x minus the nearest number of periods (Cody-Waite, two terms),
+         * then the ends are fixed up (r + period/2 and r - period/2 are exact).
+         */
+        template <typename PERIOD>
+        double wrap_symmetric_kernel(double x)
+        {
+            double const n{round_kernel(x * PERIOD::inverse())};
+            double r{(x - n * PERIOD::high()) - n * PERIOD::low()};
+            r += select(sign_mask(r + 0.5 * PERIOD::period()), PERIOD::period());
+            return r - select(~sign_mask(r - 0.5 * PERIOD::period()), PERIOD::period());
+        }
+
+        /* x wrapped to [0, period): as wrap_symmetric_kernel, with the floor of the number of periods */
+        template <typename PERIOD>
+        double wrap_positive_kernel(double x)
+        {
+            double const q{x * PERIOD::inverse()};
+            double n{round_kernel(q)};
+            n -= select(sign_mask(q - n), 1.0);
+            double r{(x - n * PERIOD::high()) - n * PERIOD::low()};
+            r += select(sign_mask(r), PERIOD::period());
+            return r - select(~sign_mask(r - PERIOD::period()), PERIOD::period());
+        }
+
+        /* wrapping of the angles out of the kernel range (huge or non-finite) */
+        template <typename PERIOD>
+        double wrap_symmetric_precise(double x)
+        {
+            double const r{std::remainder(x, PERIOD::period())};
+            return (r >= 0.5 * PERIOD::period()) ? r - PERIOD::period() : r;
+        }
+
+        template <typename PERIOD>
+        double wrap_positive_precise(double x)
+        {
+            double r{std::fmod(x, PERIOD::period())};
+            r = (r < 0.0) ? r + PERIOD::period() : r;
+            return (r >= PERIOD::period()) ? r - PERIOD::period() : r;
+        }
+
+        template <typename PERIOD>
+        struct wrap_symmetric_function
+        {
+            static double fast(double x) { return wrap_symmetric_kernel<PERIOD>(x); }
+            static double precise(double x) { return wrap_symmetric_precise<PERIOD>(x); }
+        };
+
+        template <typename PERIOD>
+        struct wrap_positive_function
+        {
+            static double fast(double x) { return wrap_positive_kernel<PERIOD>(x); }
+            static double precise(double x) { return wrap_positive_precise<PERIOD>(x); }
+        };
+
+        /*
+         * Batch wrapping: one vectorized pass checks that all the angles are in the kernel range, then
+         * either the vectorized kernel loop or a per-angle fallback loop runs, so `in` and `out` may alias.
+         */
+        template <typename FUNCTION, typename TY, typename SC, typename LA>
+        void batch_wrap(Unit<TY, Quantity<>, SC, LA> const *in, Unit<TY, Quantity<>, SC, LA> *out, std::size_t size)
+        {
+            static_assert(is_batch_type<TY>::value, "==>> BATCH FUNCTIONS REQUIRE float OR double UNITS! <<==");
+            using period = typename angle_period<SC>::type;
+            std::uint64_t overflow{0};
+            for (std::size_t i = 0; i < size; ++i)
+                overflow |= wrap_kernel_overflow<period>(in[i]());
+            if (overflow == 0)
+            {
+                for (std::size_t i = 0; i < size; ++i)
+                    out[i] = Unit<TY, Quantity<>, SC, LA>{static_cast<TY>(FUNCTION::fast(in[i]()))};
+                return;
+            }
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                double const x{in[i]()};
+                out[i] = Unit<TY, Quantity<>, SC, LA>{
+                    static_cast<TY>(in_wrap_kernel_range<period>(x) ? FUNCTION::fast(x) : FUNCTION::precise(x))};
+            }
+        }
+    } // namespace utils
+    ///@endcond
+
+    /**
+     * @brief It computes `out[i] = sin(in[i])` for `size` radian angles (`in` and `out` may alias).
+     * @note Polynomial kernel, max error < 2.5 ULP for |angle| <= 2^20 rad, std::sin otherwise.
+     */
+    template <typename TY, typename LA>
+    void sin(stu::numeral_rad<TY, LA> const *in, stu::numeral_unit<TY> *out, std::size_t size)
+    {
+        static_assert(utils::is_batch_type<TY>::value, "==>> BATCH FUNCTIONS REQUIRE float OR double UNITS! <<==");
+        if (utils::trig_kernel_overflow(in, size) == 0)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                double s, c;
+                utils::sincos_kernel(in[i](), s, c);
+                out[i] = stu::numeral_unit<TY>{static_cast<TY>(s)};
+            }
+            return;
+        }
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            double const x{in[i]()};
+            double s{std::sin(x)}, c;
+            if (utils::in_trig_kernel_range(x))
+                utils::sincos_kernel(x, s, c);
+            out[i] = stu::numeral_unit<TY>{static_cast<TY>(s)};
+        }
+    }
+
+    /**
+     * @brief It computes `out[i] = cos(in[i])` for `size` radian angles (`in` and `out` may alias).
+     * @note Polynomial kernel, max error < 2.5 ULP for |angle| <= 2^20 rad, std::cos otherwise.
+     */
+    template <typename TY, typename LA>
+    void cos(stu::numeral_rad<TY, LA> const *in, stu::numeral_unit<TY> *out, std::size_t size)
+    {
+        static_assert(utils::is_batch_type<TY>::value, "==>> BATCH FUNCTIONS REQUIRE float OR double UNITS! <<==");
+        if (utils::trig_kernel_overflow(in, size) == 0)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                double s, c;
+                utils::sincos_kernel(in[i](), s, c);
+                out[i] = stu::numeral_unit<TY>{static_cast<TY>(c)};
+            }
+            return;
+        }
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            double const x{in[i]()};
+            double s, c{std::cos(x)};
+            if (utils::in_trig_kernel_range(x))
+                utils::sincos_kernel(x, s, c);
+            out[i] = stu::numeral_unit<TY>{static_cast<TY>(c)};
+        }
+    }
+
+    /**
+     * @brief It computes `sin_out[i] = sin(in[i])` and `cos_out[i] = cos(in[i])` in one pass
+     * (`in` may alias `sin_out` or `cos_out`).
+     * @note Polynomial kernel, max error < 2.5 ULP for |angle| <= 2^20 rad, std::sin/std::cos otherwise.
+     */
+    template <typename TY, typename LA>
+    void sincos(stu::numeral_rad<TY, LA> const *in, stu::numeral_unit<TY> *sin_out, stu::numeral_unit<TY> *cos_out,
+                std::size_t size)
+    {
+        static_assert(utils::is_batch_type<TY>::value, "==>> BATCH FUNCTIONS REQUIRE float OR double UNITS! <<==");
+        if (utils::trig_kernel_overflow(in, size) == 0)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                double s, c;
+                utils::sincos_kernel(in[i](), s, c);
+                sin_out[i] = stu::numeral_unit<TY>{static_cast<TY>(s)};
+                cos_out[i] = stu::numeral_unit<TY>{static_cast<TY>(c)};
+            }
+            return;
+        }
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            double const x{in[i]()};
+            double s, c;
+            if (utils::in_trig_kernel_range(x))
+                utils::sincos_kernel(x, s, c);
+            else
+            {
+                s = std::sin(x);
+                c = std::cos(x);
+            }
+            sin_out[i] = stu::numeral_unit<TY>{static_cast<TY>(s)};
+            cos_out[i] = stu::numeral_unit<TY>{static_cast<TY>(c)};
+        }
+    }
+
+    /**
+     * @brief It builds `out[i] = polar(rho[i], theta[i])` for `size` magnitudes and radian angles in one pass.
+     * @note Polynomial kernel, max error < 2.5 ULP for |angle| <= 2^20 rad, std::polar otherwise.
+     */
+    template <typename UN, typename TY, typename LA>
+    void polar(UN const *rho, stu::numeral_rad<TY, LA> const *theta, CUnit<UN> *out, std::size_t size)
+    {
+        static_assert(utils::is_batch_type<TY>::value, "==>> BATCH FUNCTIONS REQUIRE float OR double UNITS! <<==");
+        static_assert(std::is_same<typename UN::type, TY>::value,
+                      "==>> MAGNITUDES AND ANGLES MUST HAVE THE SAME UNDERLYING TYPE! <<==");
+        if (utils::trig_kernel_overflow(theta, size) == 0)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                double s, c;
+                utils::sincos_kernel(theta[i](), s, c);
+                out[i] = CUnit<UN>{UN{static_cast<TY>(rho[i]() * c)}, UN{static_cast<TY>(rho[i]() * s)}};
+            }
+            return;
+        }
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            UN const magnitude{rho[i]};
+            stu::numeral_rad<TY, LA> const angle{theta[i]};
+            double s, c;
+            utils::sincos_kernel(angle(), s, c);
+            out[i] = utils::in_trig_kernel_range(angle())
+                         ? CUnit<UN>{UN{static_cast<TY>(magnitude() * c)}, UN{static_cast<TY>(magnitude() * s)}}
+                         : stu::polar(magnitude, angle);
+        }
+    }
+
+    /**
+     * @brief It computes `out[i] = exp(in[i])` for `size` numeral units.
+     * @note `accuracy::fast` max error < 1.5 ULP.
+     */
+    template <accuracy ACCURACY = accuracy::precise, typename TY, typename LA>
+    void exp(stu::numeral_unit<TY, LA> const *in, stu::numeral_unit<TY> *out, std::size_t size)
+    {
+        utils::batch_unary<ACCURACY, utils::exp_function>(in, out, size);
+    }
+
+    /**
+     * @brief It computes `out[i] = log(in[i])` for `size` numeral units.
+     * @note `accuracy::fast` max error < 1 ULP.
+     */
+    template <accuracy ACCURACY = accuracy::precise, typename TY, typename LA>
+    void log(stu::numeral_unit<TY, LA> const *in, stu::numeral_unit<TY> *out, std::size_t size)
+    {
+        utils::batch_unary<ACCURACY, utils::log_function>(in, out, size);
+    }
+
+    /**
+     * @brief It computes `out[i] = log10(in[i])` for `size` numeral units.
+     * @note `accuracy::fast` max error < 2 ULP.
+     */
+    template <accuracy ACCURACY = accuracy::precise, typename TY, typename LA>
+    void log10(stu::numeral_unit<TY, LA> const *in, stu::numeral_unit<TY> *out, std::size_t size)
+    {
+        utils::batch_unary<ACCURACY, utils::log10_function>(in, out, size);
+    }
+
+    /**
+     * @brief It computes `out[i] = tanh(in[i])` for `size` numeral units.
+     * @note `accuracy::fast` max error < 3.5 ULP.
+     */
+    template <accuracy ACCURACY = accuracy::precise, typename TY, typename LA>
+    void tanh(stu::numeral_unit<TY, LA> const *in, stu::numeral_unit<TY> *out, std::size_t size)
+    {
+        utils::batch_unary<ACCURACY, utils::tanh_function>(in, out, size);
+    }
+
+    /**
+     * @brief It computes `out[i] = pow(base[i], exponent[i])` for `size` numeral units.
+     * @note `accuracy::fast` max error < 1.3 ULP, negative or subnormal bases and results out of
+     *       the normal range are computed by std::pow.
+     */
+    template <accuracy ACCURACY = accuracy::precise, typename TY, typename LA1, typename LA2>
+    void pow(stu::numeral_unit<TY, LA1> const *base, stu::numeral_unit<TY, LA2> const *exponent,
+             stu::numeral_unit<TY> *out, std::size_t size)
+    {
+        static_assert(utils::is_batch_type<TY>::value, "==>> BATCH FUNCTIONS REQUIRE float OR double UNITS! <<==");
+        if (ACCURACY == accuracy::precise)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+                out[i] = stu::numeral_unit<TY>{std::pow(base[i](), exponent[i]())};
+            return;
+        }
+        utils::batch_pow_fast(base, exponent, 1, out, size);
+    }
+
+    /**
+     * @brief It computes `out[i] = pow(base[i], exponent)` for `size` numeral units.
+     * @note `accuracy::fast` max error < 1.3 ULP, negative or subnormal bases and results out of
+     *       the normal range are computed by std::pow.
+     */
+    template <accuracy ACCURACY = accuracy::precise, typename TY, typename LA1, typename LA2>
+    void pow(stu::numeral_unit<TY, LA1> const *base, stu::numeral_unit<TY, LA2> const &exponent,
+             stu::numeral_unit<TY> *out, std::size_t size)
+    {
+        static_assert(utils::is_batch_type<TY>::value, "==>> BATCH FUNCTIONS REQUIRE float OR double UNITS! <<==");
+        if (ACCURACY == accuracy::precise)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+                out[i] = stu::numeral_unit<TY>{std::pow(base[i](), exponent())};
+            return;
+        }
+        utils::batch_pow_fast(base, &exponent, 0, out, size);
+    }
+
+    /**
+     * @brief It returns a radian or degree angle wrapped to [-π, π) or [-180°, 180°).
+     */
+    template <typename TY, typename SC, typename LA>
+    Unit<TY, Quantity<>, SC, LA> wrap_angle(Unit<TY, Quantity<>, SC, LA> const &angle)
+    {
+        using function = utils::wrap_symmetric_function<typename utils::angle_period<SC>::type>;
+        double const x{angle()};
+        return Unit<TY, Quantity<>, SC, LA>{static_cast<TY>(
+            utils::in_wrap_kernel_range<typename utils::angle_period<SC>::type>(x) ? function::fast(x) : function::precise(x))};
+    }
+
+    /**
+     * @brief It returns a radian or degree angle wrapped to [0, 2π) or [0°, 360°).
+     */
+    template <typename TY, typename SC, typename LA>
+    Unit<TY, Quantity<>, SC, LA> wrap_angle_positive(Unit<TY, Quantity<>, SC, LA> const &angle)
+    {
+        using function = utils::wrap_positive_function<typename utils::angle_period<SC>::type>;
+        double const x{angle()};
+        return Unit<TY, Quantity<>, SC, LA>{static_cast<TY>(
+            utils::in_wrap_kernel_range<typename utils::angle_period<SC>::type>(x) ? function::fast(x) : function::precise(x))};
+    }
+
+    /**
+     * @brief It returns `angle` shifted by the whole number of turns that brings it nearest to `reference`,
+     *        e.g. the unwrapped phase of a sample from the unwrapped phase of the previous one.
+     */
+    template <typename TY, typename SC, typename LA1, typename LA2>
+    Unit<TY, Quantity<>, SC, LA2> unwrap_phase(Unit<TY, Quantity<>, SC, LA1> const &reference,
+                                               Unit<TY, Quantity<>, SC, LA2> const &angle)
+    {
+        using period = typename utils::angle_period<SC>::type;
+        double const n{std::nearbyint((reference() - angle()) * period::inverse())};
+        return Unit<TY, Quantity<>, SC, LA2>{static_cast<TY>((angle() + n * period::high()) + n * period::low())};
+    }
+
+    /**
+     * @brief It computes `out[i] = wrap_angle(in[i])` for `size` radian or degree angles (`in` may be `out`).
+     * @note Branch-free vectorized kernel for angles below 2^29 turns, std::remainder otherwise.
+     */
+    template <typename TY, typename SC, typename LA>
+    void wrap_angle(Unit<TY, Quantity<>, SC, LA> const *in, Unit<TY, Quantity<>, SC, LA> *out, std::size_t size)
+    {
+        utils::batch_wrap<utils::wrap_symmetric_function<typename utils::angle_period<SC>::type>>(in, out, size);
+    }
+
+    /**
+     * @brief It computes `out[i] = wrap_angle_positive(in[i])` for `size` radian or degree angles (`in` may be `out`).
+     * @note Branch-free vectorized kernel for angles below 2^29 turns, std::fmod otherwise.
+     */
+    template <typename TY, typename SC, typename LA>
+    void wrap_angle_positive(Unit<TY, Quantity<>, SC, LA> const *in, Unit<TY, Quantity<>, SC, LA> *out, std::size_t size)
+    {
+        utils::batch_wrap<utils::wrap_positive_function<typename utils::angle_period<SC>::type>>(in, out, size);
+    }
+
+    /**
+     * @brief It unwraps `size` phase samples (`in` may be `out`): every jump between consecutive samples
+     *        larger than half a turn is removed by adding whole turns, so `out[i] - in[i]` are whole turns.
+     * @note Branch-free, the running number of turns is a loop-carried sum.
+     */
+    template <typename TY, typename SC, typename LA>
+    void unwrap_phase(Unit<TY, Quantity<>, SC, LA> const *in, Unit<TY, Quantity<>, SC, LA> *out, std::size_t size)
+    {
+        static_assert(utils::is_batch_type<TY>::value, "==>> BATCH FUNCTIONS REQUIRE float OR double UNITS! <<==");
+        using period = typename utils::angle_period<SC>::type;
+        if (size == 0)
+            return;
+        double previous{in[0]()};
+        double turns{0.0};
+        out[0] = in[0];
+        for (std::size_t i = 1; i < size; ++i)
+        {
+            double const current{in[i]()};
+            turns -= utils::round_kernel((current - previous) * period::inverse());
+            previous = current;
+            out[i] = Unit<TY, Quantity<>, SC, LA>{static_cast<TY>((current + turns * period::high()) + turns * period::low())};
+        }
+    }
+
+} // namespace stu
+
+#endif // STRONGUNITVMATH_H
@@ -7,7 +7,7 @@
  * MIT License
  */
 
-#include "src/lib/StrongUnit.h"
+#include "src/lib/StrongUnitIO.h"
 #include <vector>
 
 using namespace stu::literals;
@@ -9,6 +9,7 @@
 
 #include "src/lib/StrongTypeDefinition.h"
 #include "src/lib/SIBaseUnits.h"
+#include "src/lib/StrongUnitIO.h"
 
 using namespace stu::literals;
 
@@ -9,6 +9,7 @@
 
 #include "src/lib/StrongTypeDefinition.h"
 #include "src/lib/SIDerivedUnits.h"
+#include "src/lib/StrongUnitIO.h"
 
 using namespace stu::symbols;
 using namespace stu::prefixes;
@@ -45,11 +46,14 @@ int main()
     std::cout << "\n f = ";
     f.print();
 
-    stu::kelvin const T0 = 273.15*_K;
-    stu::celsius g = 300.0*_K - T0;
+    stu::celsius g = 300.0*_K; // affine conversion: 300 K is 26.85 degree Celsius
     std::cout << "\n celsius t = ";
     g.print();
 
+    stu::kelvin dT = g - stu::celsius{20.0}; // difference of two points is a kelvin
+    std::cout << "\n celsius dT = ";
+    dT.print();
+
     auto akilogram = k_*_g ; // usage of prefix kilo allows automatic scale conversion
     std::cout << "\n a kg = ";
     akilogram.print();
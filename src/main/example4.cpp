@@ -2,14 +2,15 @@
  * @file example4.cpp
  * @author Massimo Mattelliano (mattemax@yahoo.com)
  * @brief
- * Basic usage of NonSIBaseUnits and SISpecialDerivedUnits headers
+ * Basic usage of NonSIBaseUnits and SISpecialDerivedUnits headers,
+ * through the explicit instantiations of SIUnitsInstances.h
  * @copyright Copyright (c) 2022
  * MIT License
  */
 
 #include "src/lib/StrongTypeDefinition.h"
-#include "src/lib/NonSIBaseUnits.h"
-#include "src/lib/SISpecialDerivedUnits.h"
+#include "src/lib/SIUnitsInstances.h"
+#include "src/lib/StrongUnitIO.h"
 
 using namespace stu::literals;
 using namespace stu::symbols;
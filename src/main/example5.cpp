@@ -9,7 +9,7 @@
 
 #include "src/lib/StrongTypeDefinition.h"
 #include "src/lib/NonSIBaseUnits.h"
-#include "src/lib/StrongCUnit.h"
+#include "src/lib/StrongCUnitIO.h"
 
 using namespace stu::literals;
 using namespace stu::symbols;
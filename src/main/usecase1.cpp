@@ -9,6 +9,7 @@
 
 #include "src/lib/StrongTypeDefinition.h"
 #include "src/lib/NonSIBaseUnits.h"
+#include "src/lib/StrongUnitIO.h"
 
 using namespace stu::literals;
 using namespace stu::symbols;
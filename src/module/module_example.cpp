@@ -0,0 +1,34 @@
+/**
+ * @file module_example.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Basic usage of the `stu` C++20 named module
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+
+#include <cstdio>
+
+import stu;
+
+using namespace stu::literals;
+using namespace stu::symbols;
+using namespace stu::prefixed_literals;
+using namespace stu::constants;
+
+int main()
+{
+    std::printf("  \nModule example\n");
+
+    stu::meter a = 1.5_km;
+    std::printf("\n a = %g m", a());
+
+    stu::meter_per_second v = a / (2 * _s);
+    std::printf("\n v = %g m/s", v());
+
+    stu::ohm r = 10.0_V / 2.0_A;
+    std::printf("\n r = %g ohm", r());
+
+    auto z = (_1 + j) * _A;
+    std::printf("\n |z| = %g A\n", stu::abs(z)());
+}
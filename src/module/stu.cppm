@@ -0,0 +1,67 @@
+/**
+ * @file stu.cppm
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * C++20 named module `stu` exporting the strong unit headers (`import stu;`).
+ * @note Literals, symbols, prefixes and constants are exported by their namespaces,
+ *       e.g. `using namespace stu::literals;`. The DEF_* macros are not exported,
+ *       further units still require the headers.
+ * @copyright Copyright (c) 2022
+ * MIT License
+ * 
+ * Copyright (c) 2022 Massimo Mattelliano
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+module;
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <ratio>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <complex>
+#include <string>
+#include <iostream>
+
+#define STU_MODULE
+
+export module stu;
+
+export extern "C++"
+{
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/NonSIBaseUnits.h"
+#include "src/lib/SISpecialDerivedUnits.h"
+#include "src/lib/SIPrefixedLiterals.h"
+#include "src/lib/StrongCUnit.h"
+#include "src/lib/StrongCUnitIO.h"
+#include "src/lib/StrongUnitVMath.h"
+#include "src/lib/StrongAtomicUnit.h"
+#include "src/lib/StrongUnitHistogram.h"
+#include "src/lib/StrongUnitChrono.h"
+#include "src/lib/StrongUnitFastTrig.h"
+#include "src/lib/StrongUnitConstexprMath.h"
+}
@@ -0,0 +1,53 @@
+/**
+ * @file SIPrefixedLiterals_test.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * A set of tests for SIPrefixedLiterals
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#include <string>
+#include <type_traits>
+#include "gtest/gtest.h"
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/SIPrefixedLiterals.h"
+
+using namespace stu::literals;
+using namespace stu::symbols;
+using namespace stu::prefixes;
+using namespace stu::prefixed_literals;
+
+TEST(SIPrefixedLiterals, values)
+{
+    static_assert(1_km == 1000_m, "==>> COMPILE-TIME PREFIXED LITERAL <<==");
+    static_assert(2.5_ms == 0.0025_s, "==>> COMPILE-TIME PREFIXED LITERAL <<==");
+
+    EXPECT_EQ(1_km, 1000.0_m);
+    EXPECT_EQ(1.5_km, 1500_m);
+    EXPECT_EQ(250_mm, 0.25_m);
+    EXPECT_EQ(3_kW, 3000_W);
+    EXPECT_EQ(2_MHz, 2000000_Hz);
+    EXPECT_EQ(1_Gg, 1000000_kg);
+    EXPECT_EQ(1_mg, 0.000001_kg);
+    EXPECT_DOUBLE_EQ(stu::second{5_mcs}(), 5e-6);
+    EXPECT_DOUBLE_EQ(stu::ampere{7_nA}(), 7e-9);
+    EXPECT_DOUBLE_EQ(stu::meter{4_Em}(), 4e18);
+    EXPECT_DOUBLE_EQ(stu::radian{1500_mrad}(), 1.5);
+}
+
+TEST(SIPrefixedLiterals, types)
+{
+    /* the integer (unsigned long long) and floating (long double) overloads give the same type */
+    EXPECT_TRUE((std::is_same<decltype(1_km), decltype(1.0_km)>::value));
+    EXPECT_TRUE((std::is_same<decltype(1_km)::type, STU_UNIT_TYPE>::value));
+    EXPECT_TRUE((std::is_same<decltype(1_km)::quantity, stu::meter::quantity>::value));
+    EXPECT_TRUE((std::is_same<decltype(1_km)::scale, stu::utils::mul_scales_t<stu::meter::scale, stu::scale::kilo>>::value));
+    EXPECT_EQ(std::string{decltype(1_km)::label::name()}, "_km");
+    EXPECT_EQ(std::string{decltype(3_kW)::label::name()}, "_kW");
+
+    /* 1_km and k_*_m have the same quantity and scale, but different labels, hence different types */
+    auto const symbol_km = 1 * k_ * _m;
+    EXPECT_TRUE((std::is_same<decltype(symbol_km)::scale, decltype(1_km)::scale>::value));
+    EXPECT_FALSE((std::is_same<std::remove_const<decltype(symbol_km)>::type, decltype(1_km)>::value));
+    EXPECT_EQ(symbol_km, 1_km);
+}
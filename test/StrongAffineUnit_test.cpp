@@ -0,0 +1,163 @@
+/**
+ * @file StrongAffineUnit_test.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * A set of tests for StrongAffineUnit
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#include <sstream>
+#include <type_traits>
+#include <utility>
+#include "gtest/gtest.h"
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/StrongAffineUnit.h"
+#include "src/lib/StrongUnitIO.h"
+
+using namespace stu::literals;
+
+namespace stu
+{
+    DEF_QUANTITY(Temperature, std::ratio<0>, std::ratio<0>, std::ratio<0>, std::ratio<0>, std::ratio<1>)
+
+    DEF_SCALE(unity, 1U)
+    DEF_SCALE(milli, 1U, 1000U)
+    DEF_SCALE(K2Ra, 5U, 9U)
+
+    DEF_UNIT(Temperature, kelvin, STU_UNIT_TYPE, _K, unity)
+    DEF_UNIT(Temperature, millikelvin, STU_UNIT_TYPE, _mK, milli)
+    DEF_UNIT(Temperature, rankine, STU_UNIT_TYPE, _Ra, K2Ra)
+
+    DEF_QUANTITY(Length, std::ratio<1>)
+    DEF_UNIT(Length, meter, STU_UNIT_TYPE, _m, unity)
+
+    DEF_AFFINE_UNIT(celsius, kelvin, _Cdeg, std::ratio<27315, 100>)
+    DEF_AFFINE_UNIT(fahrenheit, rankine, _Fdeg, std::ratio<45967, 180>)
+}
+
+namespace
+{
+    template <typename...>
+    using void_t = void;
+
+    template <typename LEFT, typename RIGHT, typename = void>
+    struct is_subtractable : std::false_type
+    {
+    };
+    template <typename LEFT, typename RIGHT>
+    struct is_subtractable<LEFT, RIGHT, void_t<decltype(std::declval<LEFT>() - std::declval<RIGHT>())>>
+        : std::true_type
+    {
+    };
+
+    template <typename LEFT, typename RIGHT, typename = void>
+    struct is_comparable : std::false_type
+    {
+    };
+    template <typename LEFT, typename RIGHT>
+    struct is_comparable<LEFT, RIGHT,
+                         void_t<decltype(std::declval<LEFT>() < std::declval<RIGHT>()),
+                                decltype(std::declval<LEFT>() == std::declval<RIGHT>())>> : std::true_type
+    {
+    };
+}
+
+TEST(StrongAffineUnit, Conversion_celsius_to_kelvin)
+{
+    stu::kelvin k = 20.0_Cdeg;
+    EXPECT_NEAR(k(), 293.15, 1e-9);
+
+    stu::celsius c = 300.0_K;
+    EXPECT_NEAR(c(), 26.85, 1e-9);
+
+    stu::millikelvin mk = 0_Cdeg;
+    EXPECT_NEAR(mk(), 273150.0, 1e-6);
+}
+
+TEST(StrongAffineUnit, Conversion_celsius_to_fahrenheit)
+{
+    stu::fahrenheit f = 100.0_Cdeg;
+    EXPECT_NEAR(f(), 212.0, 1e-9);
+
+    stu::celsius c = -40.0_Fdeg;
+    EXPECT_NEAR(c(), -40.0, 1e-9);
+
+    stu::rankine r = 32_Fdeg;
+    EXPECT_NEAR(r(), 491.67, 1e-9);
+}
+
+TEST(StrongAffineUnit, Point_difference)
+{
+    auto d = 30.0_Cdeg - 20.0_Cdeg;
+    static_assert(std::is_same<decltype(d), stu::kelvin>::value, "==>> DIFFERENCE TYPE MISMATCH <<==");
+    EXPECT_NEAR(d(), 10.0, 1e-9);
+
+    auto df = 212.0_Fdeg - 0.0_Cdeg;
+    static_assert(std::is_same<decltype(df), stu::rankine>::value, "==>> DIFFERENCE TYPE MISMATCH <<==");
+    EXPECT_NEAR(df(), 180.0, 1e-9);
+}
+
+TEST(StrongAffineUnit, Point_plus_difference)
+{
+    stu::celsius c = 20.0_Cdeg + 5.0_K;
+    EXPECT_NEAR(c(), 25.0, 1e-9);
+
+    c = 9.0_Ra + c;
+    EXPECT_NEAR(c(), 30.0, 1e-9);
+
+    c -= 500.0_mK;
+    EXPECT_NEAR(c(), 29.5, 1e-9);
+
+    stu::fahrenheit f = 32.0_Fdeg - 5.0_K;
+    EXPECT_NEAR(f(), 23.0, 1e-9);
+}
+
+TEST(StrongAffineUnit, Comparisons)
+{
+    EXPECT_TRUE(100.0_Cdeg == 212.0_Fdeg);
+    EXPECT_TRUE(0.0_Cdeg > 0.0_Fdeg);
+    EXPECT_TRUE(0.0_Cdeg < stu::celsius{300.0_K});
+    EXPECT_TRUE(20.0_Cdeg != 20.0_Fdeg);
+    EXPECT_TRUE(20.0_Cdeg >= 20.0_Cdeg);
+}
+
+TEST(StrongAffineUnit, Operand_constraints)
+{
+    static_assert(is_subtractable<stu::celsius, stu::fahrenheit>::value, "==>> POINT-POINT <<==");
+    static_assert(std::is_same<decltype(20.0_Cdeg - 5.0_K), stu::celsius>::value, "==>> POINT-DIFFERENCE <<==");
+    static_assert(is_comparable<stu::celsius, stu::fahrenheit>::value, "==>> POINT COMPARISON <<==");
+
+    static_assert(!is_subtractable<stu::celsius, double>::value, "==>> POINT-SCALAR <<==");
+    static_assert(!is_subtractable<stu::celsius, stu::meter>::value, "==>> POINT-OTHER QUANTITY <<==");
+    static_assert(!is_comparable<stu::celsius, double>::value, "==>> POINT AND SCALAR <<==");
+    static_assert(!is_comparable<stu::celsius, int>::value, "==>> POINT AND SCALAR <<==");
+    static_assert(!is_comparable<stu::celsius, stu::kelvin>::value, "==>> POINT AND DIFFERENCE <<==");
+    static_assert(!is_comparable<stu::celsius, stu::meter>::value, "==>> POINT AND OTHER QUANTITY <<==");
+
+    /* the kelvin of an operator is a difference, the kelvin of a conversion is an absolute temperature */
+    EXPECT_NEAR((20.0_Cdeg - 5.0_K)(), 15.0, 1e-9);
+    EXPECT_NEAR((20.0_Cdeg - stu::celsius{5.0_K})(), 288.15, 1e-9);
+}
+
+TEST(StrongAffineUnit, Batch_conversion)
+{
+    stu::celsius in[]{-40.0_Cdeg, 0.0_Cdeg, 37.0_Cdeg, 100.0_Cdeg};
+    stu::fahrenheit out[4];
+    stu::convert(in, out, 4);
+    EXPECT_NEAR(out[0](), -40.0, 1e-9);
+    EXPECT_NEAR(out[1](), 32.0, 1e-9);
+    EXPECT_NEAR(out[2](), 98.6, 1e-9);
+    EXPECT_NEAR(out[3](), 212.0, 1e-9);
+
+    stu::kelvin k[4];
+    stu::convert(out, k, 4);
+    EXPECT_NEAR(k[0](), 233.15, 1e-9);
+    EXPECT_NEAR(k[3](), 373.15, 1e-9);
+}
+
+TEST(StrongAffineUnit, Stream_output)
+{
+    std::ostringstream os;
+    os << 20.5_Cdeg;
+    EXPECT_EQ(os.str(), "20.5*_Cdeg");
+}
@@ -0,0 +1,164 @@
+/**
+ * @file StrongAtomicUnit_test.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * A set of tests for StrongAtomicUnit
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/StrongAtomicUnit.h"
+
+using namespace stu::literals;
+
+namespace stu
+{
+    DEF_QUANTITY(Energy, std::ratio<-2>, std::ratio<2>, std::ratio<1>)
+
+    DEF_SCALE(unity, 1U)
+    DEF_SCALE(kilo, 1000U)
+
+    DEF_UNIT(Energy, joule, STU_UNIT_TYPE, _J, unity)
+    DEF_UNIT(Energy, kilojoule, STU_UNIT_TYPE, _kJ, kilo)
+    DEF_UNIT(Energy, joule_f, float, _Jf, unity)
+}
+
+TEST(StrongAtomicUnit, load_store_exchange)
+{
+    stu::AtomicUnit<stu::joule> total{2.0_J};
+    stu::joule const delta = 2.0_J;
+    static_assert(noexcept(total.load()) && noexcept(total.fetch_add(delta)),
+                  "==>> unchecked atomic units must not throw <<==");
+    EXPECT_EQ(total.load()(), 2.0);
+
+    total.store(1.5_kJ);
+    EXPECT_EQ(total.load(std::memory_order_acquire)(), 1500.0);
+
+    stu::joule previous = total.exchange(3.0_J);
+    EXPECT_EQ(previous(), 1500.0);
+    EXPECT_EQ(static_cast<stu::joule>(total)(), 3.0);
+
+    stu::joule assigned = (total = 0.25_kJ);
+    EXPECT_EQ(assigned(), 250.0);
+    EXPECT_EQ(total.load()(), 250.0);
+}
+
+TEST(StrongAtomicUnit, fetch_add_scale_conversion)
+{
+    stu::AtomicUnit<stu::joule> total;
+    EXPECT_EQ(total.fetch_add(1.0_J)(), 0.0);
+    EXPECT_EQ(total.fetch_add(2.0_kJ)(), 1.0);
+    EXPECT_EQ(total.fetch_sub(0.5_kJ, std::memory_order_relaxed)(), 2001.0);
+    EXPECT_EQ((total += 4.0_J)(), 1505.0);
+    EXPECT_EQ((total -= 0.005_kJ)(), 1500.0);
+
+    stu::AtomicUnit<stu::kilojoule> kilo{1500.0_J};
+    EXPECT_EQ(kilo.load()(), 1.5);
+    kilo += 500.0_J;
+    EXPECT_EQ(kilo.load()(), 2.0);
+}
+
+TEST(StrongAtomicUnit, compare_exchange)
+{
+    stu::AtomicUnit<stu::joule> total{10.0_J};
+    stu::joule expected{5.0};
+    EXPECT_FALSE(total.compare_exchange_strong(expected, 20.0_J));
+    EXPECT_EQ(expected(), 10.0);
+    EXPECT_TRUE(total.compare_exchange_strong(expected, 20.0_J));
+    EXPECT_EQ(total.load()(), 20.0);
+
+    expected = 20.0_J;
+    while (!total.compare_exchange_weak(expected, expected * 2.0))
+    {
+    }
+    EXPECT_EQ(total.load()(), 40.0);
+}
+
+TEST(StrongAtomicUnit, concurrent_fetch_add)
+{
+    stu::AtomicUnit<stu::joule> total;
+    stu::AtomicUnit<stu::joule_f> total_f;
+    int const threads = 8;
+    int const adds = 20000;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&total, &total_f, adds]()
+                             {
+                                 for (int i = 0; i < adds; ++i)
+                                 {
+                                     total.fetch_add(0.25_kJ, std::memory_order_relaxed);
+                                     total += 1.0_J;
+                                     total_f.fetch_add(stu::joule_f{1.0f}, std::memory_order_relaxed);
+                                 }
+                             });
+    }
+    for (auto &worker : workers)
+        worker.join();
+
+    EXPECT_EQ(total.load()(), 251.0 * threads * adds);
+    EXPECT_EQ(total_f.load()(), static_cast<float>(threads * adds));
+    EXPECT_TRUE(total.is_lock_free());
+    EXPECT_TRUE(total_f.is_lock_free());
+}
+
+TEST(StrongAtomicUnit, sharded_accumulator_layout)
+{
+    using accumulator = stu::ShardedAccumulator<stu::joule, 8>;
+    EXPECT_EQ(accumulator::shards(), 8U);
+    EXPECT_EQ(sizeof(accumulator), 8U * STU_CACHE_LINE_SIZE);
+    EXPECT_EQ(alignof(accumulator), static_cast<std::size_t>(STU_CACHE_LINE_SIZE));
+}
+
+TEST(StrongAtomicUnit, sharded_accumulator_concurrent_add)
+{
+    stu::ShardedAccumulator<stu::joule, 4> total;
+    int const threads = 16;
+    int const adds = 20000;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&total, adds]()
+                             {
+                                 for (int i = 0; i < adds; ++i)
+                                 {
+                                     total.add(0.25_kJ);
+                                     total += 2.0_J;
+                                     total -= 1.0_J;
+                                 }
+                             });
+    }
+    for (auto &worker : workers)
+        worker.join();
+
+    stu::joule sum = total;
+    EXPECT_EQ(sum(), 251.0 * threads * adds);
+
+    stu::kilojoule sum_kJ = total.load();
+    EXPECT_DOUBLE_EQ(sum_kJ(), 0.251 * threads * adds);
+
+    total.reset();
+    EXPECT_EQ(total.load()(), 0.0);
+}
+
+TEST(StrongAtomicUnit, sharded_accumulator_compensated)
+{
+    stu::ShardedAccumulator<stu::joule, 2> plain;
+    stu::ShardedAccumulator<stu::joule, 2, stu::summation::compensated> compensated;
+
+    plain += 1.0_J;
+    compensated += 1.0_J;
+    for (int i = 0; i < 100000; ++i)
+    {
+        plain += 1.0e-17_J;
+        compensated += 1.0e-17_J;
+    }
+
+    EXPECT_EQ(plain.load()(), 1.0);
+    EXPECT_NEAR(compensated.load()(), 1.0 + 1.0e-12, 1.0e-16);
+}
@@ -8,7 +8,7 @@
  */
 #include "gtest/gtest.h"
 #include "src/lib/StrongTypeDefinition.h"
-#include "src/lib/StrongCUnit.h"
+#include "src/lib/StrongCUnitIO.h"
 
 using namespace stu::literals;
 using namespace stu::symbols;
@@ -664,6 +664,41 @@ TEST(StrongCUnit, cunits_pow_conversion)
     EXPECT_NEAR(stu::getComplex(g).imag() - (std::complex<STU_UNIT_TYPE>{1} / ff).imag(), 0.0, 5.21e-18);
 }
 
+TEST(StrongCUnit, cunits_integer_pow_expansion)
+{
+    auto b = 1.0_m + j * 2.0_m;
+    auto c = stu::pow<3>(b);
+    EXPECT_EQ(c.real()(), -11.0);
+    EXPECT_EQ(c.imag()(), -2.0);
+
+    auto d = stu::pow<0>(b);
+    EXPECT_EQ(d.real()(), 1.0);
+    EXPECT_EQ(d.imag()(), 0.0);
+
+    auto e = stu::pow<-1>(b);
+    EXPECT_EQ(e.real()(), 0.2);
+    EXPECT_EQ(e.imag()(), -0.4);
+}
+
+TEST(StrongCUnit, cunits_rational_pow)
+{
+    auto b = 3.0_m + j * 4.0_m;
+    auto c = stu::pow<3, 2>(b);
+    auto cc = std::pow(std::complex<STU_UNIT_TYPE>{3, 4}, 1.5);
+    EXPECT_NEAR(c.real()() - cc.real(), 0.0, 1e-13);
+    EXPECT_NEAR(c.imag()() - cc.imag(), 0.0, 1e-13);
+
+    auto d = stu::cbrt(stu::pow<3>(b));
+    auto dd = std::pow(std::complex<STU_UNIT_TYPE>{3, 4} * std::complex<STU_UNIT_TYPE>{3, 4} *
+                           std::complex<STU_UNIT_TYPE>{3, 4},
+                       1.0 / 3);
+    EXPECT_NEAR(d.real()() - dd.real(), 0.0, 1e-14);
+    EXPECT_NEAR(d.imag()() - dd.imag(), 0.0, 1e-14);
+
+    stu::CUnit<stu::meter> e = stu::root<2>(b * b);
+    EXPECT_EQ(e, b);
+}
+
 TEST(StrongCUnit, cunits_sqrt_conversion)
 {
     stu::meter a = 1.0_m;
@@ -683,4 +718,4 @@ TEST(StrongCUnit, cunits_sqrt_conversion)
 }
 
 /*/
-//*/
\ No newline at end of file
+//*/
\ No newline at end of file
@@ -0,0 +1,91 @@
+/**
+ * @file StrongUnitAudit_test.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * A set of tests for the conversion audit mode (STU_CONVERSION_AUDIT)
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#define STU_CONVERSION_AUDIT
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include "gtest/gtest.h"
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/StrongUnit.h"
+
+using namespace stu::literals;
+
+namespace stu
+{
+    DEF_QUANTITY(Length, std::ratio<0>, std::ratio<1>)
+    DEF_QUANTITY(Time, std::ratio<1>)
+
+    DEF_BASE_LABEL(1, _m)
+
+    DEF_SCALE(unity, 1U)
+    DEF_SCALE(kilo, 1000U)
+    DEF_SCALE(milli, 1U, 1000U)
+
+    DEF_UNIT(Length, meter, STU_UNIT_TYPE, _m, unity)
+    DEF_UNIT(Length, metre, STU_UNIT_TYPE, _metre, unity)
+    DEF_UNIT(Length, kilometer, STU_UNIT_TYPE, _km, kilo)
+    DEF_UNIT(Time, second, STU_UNIT_TYPE, _s, unity)
+    DEF_UNIT(Time, millisecond, STU_UNIT_TYPE, _ms, milli)
+}
+
+TEST(StrongUnitAudit, counts_scale_conversions)
+{
+    stu::meter m = 1.0_km;
+    m = m + 2.0_km;
+    EXPECT_EQ((stu::conversion_audit_count<stu::kilometer, stu::meter>()), 2U);
+    EXPECT_EQ((stu::conversion_audit_count<stu::meter, stu::kilometer>()), 0U);
+
+    // left > right is right < left: the left operand is converted to the scale of the right one
+    EXPECT_TRUE(m > 0.5_km);
+    EXPECT_EQ((stu::conversion_audit_count<stu::meter, stu::kilometer>()), 1U);
+
+    // max compares (meter to kilometer) and converts the result (kilometer to meter)
+    m = stu::max(m, 4.0_km);
+    EXPECT_EQ(m(), 4000.0);
+    EXPECT_EQ((stu::conversion_audit_count<stu::kilometer, stu::meter>()), 3U);
+    EXPECT_EQ((stu::conversion_audit_count<stu::meter, stu::kilometer>()), 2U);
+
+    stu::kilometer km = m;
+    EXPECT_EQ((stu::conversion_audit_count<stu::meter, stu::kilometer>()), 3U);
+    EXPECT_EQ(km(), 4.0);
+
+    stu::metre alias = m;
+    EXPECT_EQ(alias(), 4000.0);
+    EXPECT_EQ((stu::conversion_audit_count<stu::meter, stu::metre>()), 0U);
+}
+
+TEST(StrongUnitAudit, flushes_thread_counters)
+{
+    std::thread worker([]()
+                       {
+                           stu::second total{0.0};
+                           for (int i = 0; i < 5; ++i)
+                               total += 1.0_ms;
+                           EXPECT_EQ((stu::conversion_audit_count<stu::millisecond, stu::second>()), 5U);
+                       });
+    worker.join();
+
+    stu::second s = 3.0_ms;
+    EXPECT_EQ(s(), 0.003);
+    EXPECT_EQ((stu::conversion_audit_count<stu::millisecond, stu::second>()), 6U);
+
+    std::FILE *stream = std::tmpfile();
+    ASSERT_NE(stream, nullptr);
+    stu::conversion_audit_report(stream);
+    std::rewind(stream);
+    std::string report;
+    char line[256];
+    while (std::fgets(line, sizeof line, stream) != nullptr)
+        report += line;
+    std::fclose(stream);
+
+    EXPECT_NE(report.find("stu conversion audit"), std::string::npos);
+    EXPECT_NE(report.find("b0  1/1000 -> 1"), std::string::npos) << report;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file StrongUnitChecked_test.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * A set of tests for the checked numeric policy (STU_CHECKED_ARITHMETIC)
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#define STU_CHECKED_ARITHMETIC
+
+#include <limits>
+#include <string>
+#include "gtest/gtest.h"
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/SISpecialDerivedUnits.h"
+#include "src/lib/StrongCUnit.h"
+#include "src/lib/StrongAtomicUnit.h"
+#include "src/lib/StrongUnitChrono.h"
+
+using namespace stu::literals;
+
+TEST(StrongUnitChecked, finite_values)
+{
+    constexpr stu::meter length{2.0};
+    static_assert(length() == 2.0, "==>> checked construction must stay a constant expression <<==");
+    constexpr auto literal = 1.5_m;
+    static_assert(literal() == 1.5, "==>> checked literals must stay constant expressions <<==");
+
+    stu::meter sum = 1.0_m;
+    sum += 2.0_m;
+    sum -= 0.5_m;
+    ++sum;
+    --sum;
+    EXPECT_EQ(sum(), 2.5);
+    EXPECT_EQ((10.0_m / 4.0_s)(), 2.5);
+    EXPECT_EQ((1.0_m * 1e300 * 1e-300)(), 1.0);
+}
+
+TEST(StrongUnitChecked, non_finite_values)
+{
+    stu::meter const big{1e308};
+    EXPECT_THROW(stu::meter{std::numeric_limits<double>::quiet_NaN()}, stu::arithmetic_error);
+    EXPECT_THROW(big * 10.0, stu::arithmetic_error);
+    EXPECT_THROW(big * big, stu::arithmetic_error);
+    EXPECT_THROW(0.0_m / 0.0_m, stu::arithmetic_error);
+    EXPECT_THROW(1.0 / 0.0_s, stu::arithmetic_error);
+    EXPECT_THROW(big + big, stu::arithmetic_error);
+
+    stu::meter sum = big;
+    EXPECT_THROW(sum += big, stu::arithmetic_error);
+    EXPECT_EQ(sum(), 1e308);
+}
+
+TEST(StrongUnitChecked, atomic_units)
+{
+    static_assert(!noexcept(std::declval<stu::AtomicUnit<stu::meter> &>().fetch_add(stu::meter{})),
+                  "==>> checked atomic adds must be potentially throwing <<==");
+    static_assert(!noexcept(std::declval<stu::Stopwatch<> const &>().elapsed()),
+                  "==>> checked stopwatch must be potentially throwing <<==");
+
+    double const max = std::numeric_limits<double>::max();
+    stu::AtomicUnit<stu::meter> total;
+    EXPECT_EQ(total.fetch_add(stu::meter{max})(), 0.0);
+    EXPECT_THROW(total.fetch_add(stu::meter{max}), stu::arithmetic_error);
+    EXPECT_THROW(total += stu::meter{max}, stu::arithmetic_error);
+    EXPECT_THROW(total.fetch_sub(stu::meter{-max}), stu::arithmetic_error);
+    EXPECT_EQ(total.load()(), max);
+
+    stu::ShardedAccumulator<stu::meter, 4> sharded;
+    sharded.add(stu::meter{max});
+    EXPECT_THROW(sharded.add(stu::meter{max}), stu::arithmetic_error);
+    EXPECT_THROW(sharded -= stu::meter{-max}, stu::arithmetic_error);
+    EXPECT_EQ(sharded.load()(), max);
+}
+
+TEST(StrongUnitChecked, diagnostics)
+{
+    stu::meter sum{1e308};
+    try
+    {
+        sum += stu::meter{1e308};
+        FAIL() << "overflow not detected";
+    }
+    catch (stu::arithmetic_error const &error)
+    {
+        std::string const message{error.what()};
+        EXPECT_NE(message.find("+inf"), std::string::npos) << message;
+        EXPECT_NE(message.find("operator+="), std::string::npos) << message;
+        EXPECT_NE(message.find("_m"), std::string::npos) << message;
+    }
+
+    try
+    {
+        stu::second{0.0} / stu::second{0.0};
+        FAIL() << "NaN not detected";
+    }
+    catch (stu::arithmetic_error const &error)
+    {
+        std::string const message{error.what()};
+        EXPECT_NE(message.find("NaN"), std::string::npos) << message;
+        EXPECT_NE(message.find("construction"), std::string::npos) << message;
+    }
+}
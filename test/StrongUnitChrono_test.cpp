@@ -0,0 +1,66 @@
+/**
+ * @file StrongUnitChrono_test.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * A set of tests for StrongUnitChrono
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#include <chrono>
+#include <thread>
+#include "gtest/gtest.h"
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/NonSIBaseUnits.h"
+#include "src/lib/StrongUnitChrono.h"
+
+using namespace stu::literals;
+
+namespace stu
+{
+    DEF_UNIT(quantity::time, millisecond, STU_UNIT_TYPE, _ms, scale::milli)
+}
+
+TEST(StrongUnitChrono, to_duration)
+{
+    constexpr auto ns = stu::to_duration<std::chrono::nanoseconds>(1.5_s);
+    static_assert(ns.count() == 1500000000, "constexpr to_duration");
+
+    constexpr auto minutes = stu::to_duration(2.0_min);
+    static_assert(std::is_same<decltype(minutes), std::chrono::duration<double, std::ratio<60>> const>::value, "same scale");
+    EXPECT_EQ(minutes.count(), 2.0);
+
+    EXPECT_EQ(stu::to_duration<std::chrono::seconds>(1.0_h).count(), 3600);
+    EXPECT_EQ(stu::to_duration<std::chrono::hours>(1.0_d).count(), 24);
+    EXPECT_EQ(stu::to_duration<std::chrono::milliseconds>(2.9999_ms).count(), 2);
+    using double_milliseconds = std::chrono::duration<double, std::milli>;
+    EXPECT_EQ(stu::to_duration<double_milliseconds>(0.25_s).count(), 250.0);
+}
+
+TEST(StrongUnitChrono, from_duration)
+{
+    constexpr stu::second s = stu::from_duration(std::chrono::milliseconds{1500});
+    static_assert(s() == 1.5, "constexpr from_duration");
+
+    EXPECT_EQ(stu::from_duration<stu::minute>(std::chrono::hours{2})(), 120.0);
+    EXPECT_EQ(stu::from_duration<stu::millisecond>(std::chrono::microseconds{250})(), 0.25);
+    using double_days = std::chrono::duration<double, std::ratio<86400>>;
+    EXPECT_EQ(stu::from_duration<stu::day>(double_days{1.5})(), 1.5);
+
+    auto const round_trip = stu::from_duration<stu::hour>(stu::to_duration(3.0_h));
+    EXPECT_EQ(round_trip(), 3.0);
+}
+
+TEST(StrongUnitChrono, stopwatch)
+{
+    stu::Stopwatch<> stopwatch;
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    stu::second elapsed = stopwatch.elapsed();
+    EXPECT_GE(elapsed(), 0.02);
+    EXPECT_LT(elapsed(), 10.0);
+
+    stu::Stopwatch<stu::millisecond> lap_watch;
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    stu::millisecond lap = lap_watch.lap();
+    EXPECT_GE(lap(), 5.0);
+    EXPECT_LT(lap_watch.elapsed()(), lap() + 10000.0);
+}
@@ -0,0 +1,208 @@
+/**
+ * @file StrongUnitConstexprMath_test.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * A set of tests for StrongUnitConstexprMath
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <type_traits>
+#include "gtest/gtest.h"
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/NonSIBaseUnits.h"
+#include "src/lib/SIDerivedUnits.h"
+#include "src/lib/SIPrefixedLiterals.h"
+#include "src/lib/StrongCUnit.h"
+
+using namespace stu::literals;
+using namespace stu::prefixed_literals;
+
+namespace
+{
+    /* Unit-typed table computed at compile time, i.e. stored in .rodata */
+    template <std::size_t SIZE>
+    struct sine_table
+    {
+        stu::unit values_[SIZE];
+
+        constexpr sine_table()
+        {
+            for (std::size_t k = 0; k < SIZE; ++k)
+            {
+                values_[k] = stu::sin(stu::degree{360.0 * k / SIZE});
+            }
+        }
+    };
+
+    constexpr sine_table<360> sines{};
+
+    constexpr stu::volt peak = stu::sqrt(2.0_V * 2.0_V) * stu::sqrt(stu::unit{2.0});
+    constexpr stu::hertz frequency{50.0};
+    constexpr auto pulsation = 2 * stu::constants::PI * frequency;
+
+    /* Relative error in units of the double epsilon */
+    double epsilons(long double value, double expected)
+    {
+        return (value == expected) ? 0.0
+                                   : std::fabs(static_cast<double>(value) - expected) /
+                                         (std::fabs(expected) * std::numeric_limits<double>::epsilon());
+    }
+
+    template <typename FUNCTION, typename CONSTEXPR_FUNCTION>
+    double max_epsilons(FUNCTION function, CONSTEXPR_FUNCTION constexpr_function, double low, double high)
+    {
+        double res{0};
+        for (int i = 0; i <= 20000; ++i)
+        {
+            double const x{low + (high - low) * i / 20000};
+            res = std::fmax(res, epsilons(constexpr_function(x), function(x)));
+        }
+        return res;
+    }
+
+    /* is_constant<FUNCTION>: FUNCTION::value() is a constant expression */
+    template <typename FUNCTION, typename = void>
+    struct is_constant : std::false_type
+    {
+    };
+    template <typename FUNCTION>
+    struct is_constant<FUNCTION, decltype(static_cast<void>(std::integral_constant<bool, (FUNCTION::value(), true)>{}))>
+        : std::true_type
+    {
+    };
+
+    template <long long ANGLE>
+    struct constexpr_sine
+    {
+        static constexpr stu::unit value() { return stu::sin(stu::rad{static_cast<double>(ANGLE)}); }
+    };
+
+    template <long long ANGLE>
+    struct constexpr_tangent
+    {
+        static constexpr long double value() { return stu::utils::constexpr_tan(ANGLE * 1.0e10L); }
+    };
+} // namespace
+
+TEST(StrongUnitConstexprMath, compile_time_constants)
+{
+    static_assert(sines.values_[90]() == 1.0, "==>> COMPILE-TIME TABLE <<==");
+    static_assert(sines.values_[0]() == 0.0, "==>> COMPILE-TIME TABLE <<==");
+    static_assert(stu::sqrt(9.0_m * 4.0_m) == 6.0_m, "==>> COMPILE-TIME SQRT <<==");
+    static_assert(stu::pow<1, 3>(stu::meter{27.0} * 1.0_m * 1.0_m) == 3.0_m, "==>> COMPILE-TIME CBRT <<==");
+    static_assert(3.0_m * 4.0_m / 2.0_m + 1.0_km == stu::meter{1006.0}, "==>> COMPILE-TIME OPERATORS <<==");
+    static_assert(stu::meter{7.5} % stu::meter{2.0} == stu::meter{1.5}, "==>> COMPILE-TIME MODULO <<==");
+    static_assert(stu::max(1.0_km, 999.0_m) == 1.0_km, "==>> COMPILE-TIME MAX <<==");
+
+    EXPECT_DOUBLE_EQ(peak(), 2.0 * std::sqrt(2.0));
+    EXPECT_DOUBLE_EQ(pulsation(), 100.0 * std::acos(-1.0));
+    for (std::size_t k = 0; k < 360; ++k)
+    {
+        EXPECT_NEAR(sines.values_[k](), std::sin(k * std::acos(-1.0) / 180), 1e-15) << k;
+    }
+}
+
+TEST(StrongUnitConstexprMath, unit_functions)
+{
+    constexpr auto e = stu::exp(stu::unit{1.0});
+    constexpr auto ln = stu::log(stu::unit{10.0});
+    constexpr auto decades = stu::log10(stu::unit{1000.0});
+    constexpr auto sc = stu::sincos(30.0_deg);
+    constexpr auto angle = stu::atan(stu::unit{1.0});
+    constexpr auto power = stu::pow(stu::unit{2.0}, 10.0);
+    constexpr auto hyperbolic = stu::tanh(stu::unit{0.5});
+    constexpr auto rounded = stu::round(stu::meter{-2.5});
+
+    EXPECT_DOUBLE_EQ(e(), std::exp(1.0));
+    EXPECT_DOUBLE_EQ(ln(), std::log(10.0));
+    EXPECT_EQ(decades(), 3.0);
+    EXPECT_DOUBLE_EQ(sc.first(), 0.5);
+    EXPECT_DOUBLE_EQ(sc.second(), std::sqrt(3.0) / 2);
+    EXPECT_DOUBLE_EQ(angle(), std::atan(1.0));
+    EXPECT_EQ(power(), 1024.0);
+    EXPECT_DOUBLE_EQ(hyperbolic(), std::tanh(0.5));
+    EXPECT_EQ(rounded(), -3.0);
+
+    /* run time calls are the <cmath> functions */
+    stu::unit const one{1.0};
+    EXPECT_EQ(stu::exp(one)(), std::exp(1.0));
+    EXPECT_EQ(stu::sin(stu::rad{one()})(), std::sin(1.0));
+}
+
+TEST(StrongUnitConstexprMath, precision)
+{
+    using namespace stu::utils;
+    auto const ld = [](long double (*function)(long double)) { return [function](double x) { return function(x); }; };
+
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::sqrt), ld(constexpr_sqrt), 1e-3, 1e6), 1.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::cbrt), ld(constexpr_cbrt), -1e6, 1e6), 4.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::exp), ld(constexpr_exp), -700, 700), 1.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::log), ld(constexpr_log), 1e-3, 1e6), 1.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::sin), ld(constexpr_sin), -1e4, 1e4), 1.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::cos), ld(constexpr_cos), -1e4, 1e4), 1.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::tan), ld(constexpr_tan), -1.5, 1.5), 1.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::asin), ld(constexpr_asin), -1, 1), 1.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::acos), ld(constexpr_acos), -1, 1), 1.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::atan), ld(constexpr_atan), -1e3, 1e3), 1.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::sinh), ld(constexpr_sinh), -700, 700), 2.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::cosh), ld(constexpr_cosh), -700, 700), 1.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::tanh), ld(constexpr_tanh), -20, 20), 2.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::asinh), ld(constexpr_asinh), -1e3, 1e3), 1.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::acosh), ld(constexpr_acosh), 1, 1e3), 2.0);
+    EXPECT_LE(max_epsilons(static_cast<double (*)(double)>(std::atanh), ld(constexpr_atanh), -0.999, 0.999), 2.0);
+}
+
+TEST(StrongUnitConstexprMath, special_values)
+{
+    using namespace stu::utils;
+    static_assert(constexpr_isnan(constexpr_sqrt(-1)), "==>> SQRT OF NEGATIVE <<==");
+    static_assert(constexpr_log(0) == -constexpr_inf(), "==>> LOG OF ZERO <<==");
+    static_assert(constexpr_exp(1e6L) == constexpr_inf() && constexpr_exp(-1e6L) == 0, "==>> EXP OVERFLOW <<==");
+    static_assert(constexpr_narrow<double>(constexpr_exp(1000)) == std::numeric_limits<double>::infinity(),
+                  "==>> NARROWED OVERFLOW <<==");
+    static_assert(constexpr_pow(-2, 3) == -8 && constexpr_isnan(constexpr_pow(-8, 0.5L)), "==>> POW OF NEGATIVE <<==");
+    static_assert(constexpr_fmod(1e30L, 7) == std::fmod(1e30L, 7), "==>> EXACT FMOD <<==");
+    static_assert(constexpr_atan2(0, -1) == constexpr_pi() && constexpr_atan2(-1, 0) == -constexpr_pi() / 2,
+                  "==>> ATAN2 QUADRANTS <<==");
+
+    EXPECT_EQ(constexpr_fmod(-7.5L, 2), std::fmod(-7.5L, 2.0L));
+    EXPECT_TRUE(std::isnan(constexpr_sin(constexpr_inf())));
+    EXPECT_EQ(constexpr_atanh(1), constexpr_inf());
+}
+
+TEST(StrongUnitConstexprMath, reduction_range)
+{
+    /* the exact reduction covers |x| < 2^31 * π/2 (2^21 * π/2 when long double is double) */
+    static_assert(is_constant<constexpr_sine<1000000>>::value, "==>> REDUCED ARGUMENT <<==");
+    static_assert(is_constant<constexpr_sine<-3294198>>::value, "==>> REDUCED ARGUMENT <<==");
+    static_assert(!is_constant<constexpr_sine<100000000000000000LL>>::value, "==>> ARGUMENT BEYOND THE REDUCTION <<==");
+    static_assert(!is_constant<constexpr_tangent<1000000000LL>>::value, "==>> ARGUMENT BEYOND THE REDUCTION <<==");
+
+    EXPECT_NEAR(constexpr_sine<1000000>::value()(), std::sin(1.0e6), 1e-15);
+    EXPECT_NEAR(constexpr_sine<-3294198>::value()(), std::sin(-3294198.0), 1e-15);
+    EXPECT_TRUE(std::isnan(stu::utils::constexpr_sin(1.0e20L)));
+}
+
+TEST(StrongUnitConstexprMath, complex_functions)
+{
+    constexpr stu::cunit z{stu::unit{0.5}, stu::unit{-1.25}};
+    constexpr stu::cunit compile_time[]{stu::exp(z), stu::log(z), stu::sqrt(z), stu::sin(z), stu::cos(z),
+                                        stu::tanh(z), stu::asin(z), stu::acos(z), stu::atan(z), stu::asinh(z),
+                                        stu::acosh(z), stu::atanh(z), stu::pow(z, 2.5), stu::pow<1, 3>(z)};
+    std::complex<double> const c{0.5, -1.25};
+    std::complex<double> const run_time[]{std::exp(c), std::log(c), std::sqrt(c), std::sin(c), std::cos(c),
+                                          std::tanh(c), std::asin(c), std::acos(c), std::atan(c), std::asinh(c),
+                                          std::acosh(c), std::atanh(c), std::pow(c, 2.5), std::pow(c, 1.0 / 3)};
+    for (std::size_t k = 0; k < 14; ++k)
+    {
+        EXPECT_LT(std::abs(stu::getComplex(compile_time[k]) - run_time[k]), 1e-15 * std::abs(run_time[k])) << k;
+    }
+
+    constexpr auto phasor = stu::polar(2.0_V, stu::rad{stu::constants::PI()});
+    static_assert(stu::abs(phasor) == 2.0_V, "==>> COMPILE-TIME ABS <<==");
+    EXPECT_DOUBLE_EQ(phasor.real()(), -2.0);
+    EXPECT_DOUBLE_EQ(stu::arg(phasor)(), std::acos(-1.0));
+}
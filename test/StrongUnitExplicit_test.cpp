@@ -0,0 +1,64 @@
+/**
+ * @file StrongUnitExplicit_test.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * A set of tests for the explicit conversion policy (STU_EXPLICIT_CONVERSIONS)
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#define STU_EXPLICIT_CONVERSIONS
+
+#include <type_traits>
+#include "gtest/gtest.h"
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/NonSIBaseUnits.h"
+#include "src/lib/SISpecialDerivedUnits.h"
+#include "src/lib/StrongCUnit.h"
+#include "src/lib/StrongAtomicUnit.h"
+
+using namespace stu::literals;
+
+namespace stu
+{
+    DEF_UNIT(quantity::length, kilometer, STU_UNIT_TYPE, _km, scale::kilo)
+}
+
+TEST(StrongUnitExplicit, conversion_traits)
+{
+    EXPECT_FALSE((std::is_convertible<stu::kilometer, stu::meter>::value));
+    EXPECT_TRUE((std::is_constructible<stu::meter, stu::kilometer>::value));
+    EXPECT_TRUE((std::is_convertible<stu::hertz, stu::becquerel>::value));
+    EXPECT_FALSE((std::is_convertible<stu::CUnit<stu::kilometer>, stu::CUnit<stu::meter>>::value));
+    EXPECT_TRUE((std::is_constructible<stu::CUnit<stu::meter>, stu::CUnit<stu::kilometer>>::value));
+    EXPECT_FALSE((std::is_convertible<stu::kelvin, stu::celsius>::value));
+    EXPECT_FALSE((std::is_convertible<stu::celsius, stu::fahrenheit>::value));
+}
+
+TEST(StrongUnitExplicit, unit_cast)
+{
+    stu::meter m = stu::unit_cast<stu::meter>(1.5_km);
+    EXPECT_EQ(m(), 1500.0);
+    EXPECT_EQ((m + stu::unit_cast<stu::meter>(2.0_km))(), 3500.0);
+    EXPECT_TRUE(stu::unit_cast<stu::meter>(1.0_km) > m - 600.0_m);
+    EXPECT_EQ(stu::max(m, 2.0_m)(), 1500.0);
+
+    stu::minute t = stu::unit_cast<stu::minute>(2.0_h);
+    EXPECT_EQ(t(), 120.0);
+
+    stu::becquerel activity = 2.0_Hz; // same scale: implicit
+    EXPECT_EQ(activity(), 2.0);
+
+    auto const c = stu::unit_cast<stu::CUnit<stu::meter>>(stu::CUnit<stu::kilometer>{1.0_km, 2.0_km});
+    EXPECT_EQ(c.imag()(), 2000.0);
+
+    stu::celsius temperature = stu::unit_cast<stu::celsius>(300.0_K);
+    EXPECT_NEAR(temperature(), 26.85, 1e-9);
+    EXPECT_NEAR(stu::unit_cast<stu::fahrenheit>(100.0_Cdeg)(), 212.0, 1e-9);
+    temperature += 1.0_K;
+    EXPECT_NEAR(temperature(), 27.85, 1e-9);
+
+    stu::AtomicUnit<stu::meter> total;
+    total += stu::unit_cast<stu::meter>(1.0_km);
+    total.fetch_add(1.0_km);
+    EXPECT_EQ(total.load()(), 2000.0);
+}
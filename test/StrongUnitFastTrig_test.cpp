@@ -0,0 +1,114 @@
+/**
+ * @file StrongUnitFastTrig_test.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * A set of tests for StrongUnitFastTrig
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "gtest/gtest.h"
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/NonSIBaseUnits.h"
+#include "src/lib/StrongUnitFastTrig.h"
+
+using namespace stu::literals;
+
+namespace
+{
+    template <unsigned DIGITS>
+    void check_sin_cos(double bound)
+    {
+        double max_error{0};
+        for (int i = -100000; i <= 100000; ++i)
+        {
+            double const angle{i * 0.0123456789};
+            max_error = std::fmax(max_error, std::fabs(stu::fast::sin<DIGITS>(stu::rad{angle})() - std::sin(angle)));
+            max_error = std::fmax(max_error, std::fabs(stu::fast::cos<DIGITS>(stu::rad{angle})() - std::cos(angle)));
+        }
+        EXPECT_LT(max_error, bound) << DIGITS << " digits";
+    }
+} // namespace
+
+TEST(StrongUnitFastTrig, sin_cos_precision)
+{
+    static_assert(stu::utils::fast_trig_tables<6>::sin_size == 4096, "==>> 6 DIGITS SIN TABLE SIZE <<==");
+    static_assert(stu::utils::fast_trig_tables<6>::atan_size == 512, "==>> 6 DIGITS ATAN TABLE SIZE <<==");
+    static_assert(stu::utils::fast_trig_tables<6>::sin_.values_[1024] == 1.0, "==>> COMPILE-TIME TABLE <<==");
+
+    check_sin_cos<3>(1e-3);
+    check_sin_cos<6>(1e-6);
+    check_sin_cos<7>(1e-7);
+
+    EXPECT_EQ(stu::fast::sin(0.0_rad)(), 0.0);
+    EXPECT_EQ(stu::fast::cos(0.0_rad)(), 1.0);
+    EXPECT_NEAR(stu::fast::sin(stu::degree{-30.0})(), -0.5, 1e-6);
+    EXPECT_TRUE(std::isnan(stu::fast::sin(stu::rad{std::numeric_limits<double>::infinity()})()));
+    EXPECT_TRUE(std::isnan(stu::fast::cos(stu::degree{std::numeric_limits<double>::quiet_NaN()})()));
+}
+
+TEST(StrongUnitFastTrig, degree_angles)
+{
+    double max_error{0};
+    for (int i = -7200; i <= 7200; ++i)
+    {
+        double const angle{i * 0.25};
+        double const radians{angle * 3.14159265358979323846 / 180.0};
+        max_error = std::fmax(max_error, std::fabs(stu::fast::sin(stu::degree{angle})() - std::sin(radians)));
+        max_error = std::fmax(max_error, std::fabs(stu::fast::cos(stu::degree{angle})() - std::cos(radians)));
+    }
+    EXPECT_LT(max_error, 1e-6);
+}
+
+TEST(StrongUnitFastTrig, atan2)
+{
+    double max_error{0};
+    for (int i = 0; i < 20000; ++i)
+    {
+        double const y{std::sin(i * 0.37) * (1 + i % 7)};
+        double const x{std::cos(i * 0.91) * (1 + i % 5)};
+        stu::rad const angle = stu::fast::atan2(stu::meter{y}, stu::meter{x});
+        max_error = std::fmax(max_error, std::fabs(angle() - std::atan2(y, x)));
+    }
+    EXPECT_LT(max_error, 1e-6);
+
+    double const pi{3.14159265358979323846};
+    EXPECT_EQ(stu::fast::atan2(0.0_m, 1.0_m)(), 0.0);
+    EXPECT_NEAR(stu::fast::atan2(0.0_m, stu::meter{-1.0})(), pi, 1e-15);
+    EXPECT_NEAR(stu::fast::atan2(stu::meter{-2.0}, 0.0_m)(), -pi / 2, 1e-15);
+    EXPECT_NEAR(stu::fast::atan2(1.0_m, 1.0_m)(), pi / 4, 1e-15);
+    EXPECT_NEAR(stu::fast::atan2(1.0_m, stu::meter{-std::numeric_limits<double>::infinity()})(), pi, 1e-15);
+    EXPECT_TRUE(std::isnan(stu::fast::atan2(stu::meter{std::numeric_limits<double>::quiet_NaN()}, 1.0_m)()));
+}
+
+TEST(StrongUnitFastTrig, batch)
+{
+    std::vector<stu::rad> angles;
+    std::vector<stu::degree> degrees;
+    std::vector<stu::meter> y, x;
+    for (int i = -500; i <= 500; ++i)
+    {
+        angles.push_back(stu::rad{i * 0.01});
+        degrees.push_back(stu::degree{i * 0.7});
+        y.push_back(stu::meter{i * 0.3});
+        x.push_back(stu::meter{250.0 - i});
+    }
+    std::size_t const size{angles.size()};
+    std::vector<stu::unit> s(size), c(size), sd(size), cd(size);
+    std::vector<stu::rad> a(size);
+    stu::fast::sin(angles.data(), s.data(), size);
+    stu::fast::cos(angles.data(), c.data(), size);
+    stu::fast::sin<7>(degrees.data(), sd.data(), size);
+    stu::fast::cos<7>(degrees.data(), cd.data(), size);
+    stu::fast::atan2(y.data(), x.data(), a.data(), size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        EXPECT_EQ(s[i](), stu::fast::sin(angles[i])());
+        EXPECT_EQ(c[i](), stu::fast::cos(angles[i])());
+        EXPECT_EQ(sd[i](), stu::fast::sin<7>(degrees[i])());
+        EXPECT_EQ(cd[i](), stu::fast::cos<7>(degrees[i])());
+        EXPECT_EQ(a[i](), stu::fast::atan2(y[i], x[i])());
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file StrongUnitHistogram_test.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * A set of tests for StrongUnitHistogram
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#include <cmath>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/StrongUnitHistogram.h"
+
+using namespace stu::literals;
+
+namespace stu
+{
+    DEF_QUANTITY(Time, std::ratio<1>)
+
+    DEF_SCALE(unity, 1U)
+    DEF_SCALE(milli, 1U, 1000U)
+    DEF_SCALE(micro, 1U, 1000000U)
+
+    DEF_UNIT(Time, second, STU_UNIT_TYPE, _s, unity)
+    DEF_UNIT(Time, millisecond, STU_UNIT_TYPE, _ms, milli)
+    DEF_UNIT(Time, microsecond, STU_UNIT_TYPE, _us, micro)
+}
+
+TEST(StrongUnitHistogram, percentiles_relative_error)
+{
+    stu::Histogram<stu::second> latencies;
+    for (int i = 1; i <= 10000; ++i)
+        latencies.record(stu::microsecond{static_cast<double>(i)});
+
+    EXPECT_EQ(latencies.count(), 10000U);
+    EXPECT_EQ(latencies.min()(), 1.0e-6);
+    EXPECT_DOUBLE_EQ(latencies.max()(), 1.0e-2);
+    EXPECT_NEAR(latencies.mean()(), 5000.5e-6, 1.0e-12);
+
+    double const max_error = std::ldexp(1.0, -7);
+    for (double p : {1.0, 10.0, 50.0, 90.0, 99.0, 99.9})
+    {
+        stu::second value = latencies.percentile(p);
+        double const expected = p * 1.0e-4;
+        EXPECT_LE(std::fabs(value() - expected) / expected, max_error) << p;
+    }
+
+    stu::millisecond median = latencies.percentile(50.0);
+    EXPECT_NEAR(median(), 5.0, 5.0 * max_error);
+    EXPECT_EQ(latencies.percentile(0.0)(), 1.0e-6);
+    EXPECT_DOUBLE_EQ(latencies.percentile(100.0)(), 1.0e-2);
+}
+
+TEST(StrongUnitHistogram, out_of_range_values)
+{
+    stu::Histogram<stu::second, 4U, -10, 4> latencies;
+    EXPECT_EQ(latencies.percentile(50.0)(), 0.0);
+
+    latencies.record(0.0_s);
+    latencies.record(stu::second{-1.0});
+    latencies.record(100.0_s, 2U);
+    latencies.record(stu::second{NAN});
+
+    EXPECT_EQ(latencies.count(), 4U);
+    EXPECT_EQ(latencies.min()(), -1.0);
+    EXPECT_EQ(latencies.max()(), 100.0);
+    EXPECT_EQ(latencies.percentile(25.0)(), std::ldexp(1.0 + 0.5 / 16.0, -10));
+    EXPECT_EQ(latencies.percentile(100.0)(), 100.0);
+}
+
+TEST(StrongUnitHistogram, merge_per_thread)
+{
+    int const threads = 4;
+    std::vector<stu::Histogram<stu::millisecond>> histograms(threads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&histograms, t]()
+                             {
+                                 for (int i = 0; i < 1000; ++i)
+                                     histograms[t].record(stu::second{(t * 1000 + i + 1) * 1.0e-3});
+                             });
+    }
+    for (auto &worker : workers)
+        worker.join();
+
+    stu::Histogram<stu::millisecond> total;
+    for (auto const &histogram : histograms)
+        total.merge(histogram);
+
+    EXPECT_EQ(total.count(), 4000U);
+    EXPECT_DOUBLE_EQ(total.min()(), 1.0);
+    EXPECT_DOUBLE_EQ(total.max()(), 4000.0);
+    EXPECT_NEAR(total.percentile(50.0)(), 2000.0, 2000.0 * std::ldexp(1.0, -7));
+
+    total.reset();
+    EXPECT_EQ(total.count(), 0U);
+}
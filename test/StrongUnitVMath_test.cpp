@@ -0,0 +1,374 @@
+/**
+ * @file StrongUnitVMath_test.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * A set of tests for StrongUnitVMath
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#include <algorithm>
+#include <vector>
+#include "gtest/gtest.h"
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/StrongUnitVMath.h"
+
+using namespace stu::literals;
+
+namespace stu
+{
+    DEF_QUANTITY(Length, std::ratio<0>, std::ratio<1>)
+
+    DEF_SCALE(unity, 1U)
+
+    DEF_UNIT(Length, meter, STU_UNIT_TYPE, _m, unity)
+}
+
+namespace
+{
+    double ulp_error(double value, long double reference)
+    {
+        double const ref{static_cast<double>(reference)};
+        double const ulp{std::nextafter(std::fabs(ref), INFINITY) - std::fabs(ref)};
+        return static_cast<double>(std::fabs(value - reference) / ulp);
+    }
+
+    std::vector<stu::rad> angles()
+    {
+        std::vector<stu::rad> res;
+        for (int i = -20000; i <= 20000; ++i)
+            res.push_back(stu::rad{i * 0.0123456789});
+        for (int k = -1000; k <= 1000; ++k)
+            res.push_back(stu::rad{static_cast<double>(k * 1.5707963267948966192313216916397514L)});
+        res.push_back(stu::rad{1.0e5 + 0.25});
+        res.push_back(stu::rad{1.0e7});
+        res.push_back(stu::rad{-1.0e9});
+        return res;
+    }
+} // namespace
+
+TEST(StrongUnitVMath, scalar_sincos)
+{
+    auto sc = stu::sincos(stu::rad{0.75});
+    EXPECT_TRUE((std::is_same<decltype(sc), std::pair<stu::unit, stu::unit>>::value));
+    EXPECT_EQ(sc.first(), std::sin(0.75));
+    EXPECT_EQ(sc.second(), std::cos(0.75));
+}
+
+TEST(StrongUnitVMath, batch_sin_cos_ulp)
+{
+    auto const in = angles();
+    std::vector<stu::unit> s(in.size()), c(in.size()), s1(in.size()), c1(in.size());
+    stu::sincos(in.data(), s.data(), c.data(), in.size());
+    stu::sin(in.data(), s1.data(), in.size());
+    stu::cos(in.data(), c1.data(), in.size());
+
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+        long double const x{in[i]()};
+        EXPECT_LT(ulp_error(s[i](), std::sin(x)), 2.5) << x;
+        EXPECT_LT(ulp_error(c[i](), std::cos(x)), 2.5) << x;
+        EXPECT_EQ(s[i], s1[i]);
+        EXPECT_EQ(c[i], c1[i]);
+    }
+}
+
+TEST(StrongUnitVMath, batch_non_finite)
+{
+    stu::rad in[]{stu::rad{INFINITY}, stu::rad{NAN}, stu::rad{0.0}};
+    stu::unit out[3];
+    stu::sin(in, out, 3);
+    EXPECT_TRUE(std::isnan(out[0]()));
+    EXPECT_TRUE(std::isnan(out[1]()));
+    EXPECT_EQ(out[2](), 0.0);
+}
+
+TEST(StrongUnitVMath, batch_polar)
+{
+    stu::meter rho[]{1.0_m, 2.0_m, 3.0_m, 4.0_m};
+    stu::rad theta[]{stu::rad{0.0}, stu::rad{0.5}, stu::rad{-2.0}, stu::rad{3.0e6}};
+    stu::CUnit<stu::meter> out[4];
+    stu::polar(rho, theta, out, 4);
+
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        auto const ref = stu::polar(rho[i], theta[i]);
+        EXPECT_NEAR(out[i].real()(), ref.real()(), 1e-15 * rho[i]());
+        EXPECT_NEAR(out[i].imag()(), ref.imag()(), 1e-15 * rho[i]());
+    }
+}
+
+TEST(StrongUnitVMath, batch_trig_in_place)
+{
+    std::vector<stu::rad> const in{stu::rad{0.5}, stu::rad{3.0e6}, stu::rad{-2.0}, stu::rad{INFINITY},
+                                   stu::rad{1.0e300}, stu::rad{0.0}};
+    std::vector<stu::unit> s(in.size()), c(in.size());
+    stu::sincos(in.data(), s.data(), c.data(), in.size());
+    EXPECT_EQ(s[1](), std::sin(3.0e6));
+    EXPECT_EQ(c[4](), std::cos(1.0e300));
+    EXPECT_TRUE(std::isnan(s[3]()) && std::isnan(c[3]()));
+    EXPECT_NEAR(s[2](), std::sin(-2.0), 1e-15);
+
+    /* the results overwrite the angles of a reused buffer */
+    auto const same = [](stu::unit value, stu::unit expected) {
+        return value() == expected() || (std::isnan(value()) && std::isnan(expected()));
+    };
+    std::vector<stu::rad> values{in};
+    auto *const out = reinterpret_cast<stu::unit *>(values.data());
+    stu::sin(values.data(), out, values.size());
+    for (std::size_t i = 0; i < in.size(); ++i)
+        EXPECT_TRUE(same(out[i], s[i])) << i;
+    values = in;
+    stu::cos(values.data(), out, values.size());
+    for (std::size_t i = 0; i < in.size(); ++i)
+        EXPECT_TRUE(same(out[i], c[i])) << i;
+    values = in;
+    std::vector<stu::unit> cosines(in.size());
+    stu::sincos(values.data(), out, cosines.data(), values.size());
+    for (std::size_t i = 0; i < in.size(); ++i)
+        EXPECT_TRUE(same(out[i], s[i]) && same(cosines[i], c[i])) << i;
+    values = in;
+    std::vector<stu::unit> sines(in.size());
+    stu::sincos(values.data(), sines.data(), out, values.size());
+    for (std::size_t i = 0; i < in.size(); ++i)
+        EXPECT_TRUE(same(sines[i], s[i]) && same(out[i], c[i])) << i;
+
+    stu::meter rho[]{1.0_m, 2.0_m};
+    stu::rad theta[]{stu::rad{1.0e7}, stu::rad{0.25}};
+    stu::CUnit<stu::meter> phasors[2];
+    stu::polar(rho, theta, phasors, 2);
+    EXPECT_EQ(phasors[0].real()(), stu::polar(rho[0], theta[0]).real()());
+    EXPECT_EQ(phasors[0].imag()(), stu::polar(rho[0], theta[0]).imag()());
+    EXPECT_NEAR(phasors[1].real()(), 2.0 * std::cos(0.25), 1e-15);
+}
+
+namespace
+{
+    template <typename FUNCTION, typename REFERENCE>
+    double max_ulp_error(std::vector<stu::unit> const &in, FUNCTION function, REFERENCE reference)
+    {
+        std::vector<stu::unit> out(in.size());
+        function(in.data(), out.data(), in.size());
+        double res{0.0};
+        for (std::size_t i = 0; i < in.size(); ++i)
+            res = std::fmax(res, ulp_error(out[i](), reference(static_cast<long double>(in[i]()))));
+        return res;
+    }
+
+    std::vector<stu::unit> uniform(double first, double last, int size)
+    {
+        std::vector<stu::unit> res;
+        for (int i = 0; i <= size; ++i)
+            res.push_back(stu::unit{first + (last - first) * i / size});
+        return res;
+    }
+} // namespace
+
+TEST(StrongUnitVMath, batch_exp_log_fast_ulp)
+{
+    auto const x = uniform(-708.0, 709.0, 200000);
+    EXPECT_LT(max_ulp_error(x, [](auto in, auto out, auto n) { stu::exp<stu::accuracy::fast>(in, out, n); },
+                            [](long double v) { return std::exp(v); }),
+              1.5);
+
+    std::vector<stu::unit> positive;
+    for (int e = -1000; e <= 1000; ++e)
+        positive.push_back(stu::unit{std::ldexp(1.0 + (e + 1000) / 2001.0, e)});
+    auto const near_one = uniform(0.5, 2.0, 100000);
+    EXPECT_LT(max_ulp_error(positive, [](auto in, auto out, auto n) { stu::log<stu::accuracy::fast>(in, out, n); },
+                            [](long double v) { return std::log(v); }),
+              1.0);
+    EXPECT_LT(max_ulp_error(near_one, [](auto in, auto out, auto n) { stu::log<stu::accuracy::fast>(in, out, n); },
+                            [](long double v) { return std::log(v); }),
+              1.0);
+    EXPECT_LT(max_ulp_error(near_one, [](auto in, auto out, auto n) { stu::log10<stu::accuracy::fast>(in, out, n); },
+                            [](long double v) { return std::log10(v); }),
+              2.0);
+}
+
+TEST(StrongUnitVMath, batch_tanh_fast_ulp)
+{
+    auto const x = uniform(-25.0, 25.0, 200000);
+    auto const small = uniform(-1.0e-3, 1.0e-3, 10000);
+    EXPECT_LT(max_ulp_error(x, [](auto in, auto out, auto n) { stu::tanh<stu::accuracy::fast>(in, out, n); },
+                            [](long double v) { return std::tanh(v); }),
+              3.5);
+    EXPECT_LT(max_ulp_error(small, [](auto in, auto out, auto n) { stu::tanh<stu::accuracy::fast>(in, out, n); },
+                            [](long double v) { return std::tanh(v); }),
+              3.5);
+}
+
+TEST(StrongUnitVMath, batch_pow_fast_ulp)
+{
+    auto const base = uniform(1.0e-3, 1.0e3, 100000);
+    for (double e : {-100.0, -2.5, -0.3, 0.5, 1.0, 3.0, 97.25})
+    {
+        std::vector<stu::unit> out(base.size());
+        stu::pow<stu::accuracy::fast>(base.data(), stu::unit{e}, out.data(), base.size());
+        double error{0.0};
+        for (std::size_t i = 0; i < base.size(); ++i)
+            error = std::fmax(error, ulp_error(out[i](), std::pow(static_cast<long double>(base[i]()), e)));
+        EXPECT_LT(error, 1.0) << e;
+    }
+
+    std::vector<stu::unit> exponent;
+    for (std::size_t i = 0; i < base.size(); ++i)
+        exponent.push_back(stu::unit{-50.0 + 100.0 * static_cast<double>((i * 7919) % base.size()) / base.size()});
+    std::vector<stu::unit> out(base.size());
+    stu::pow<stu::accuracy::fast>(base.data(), exponent.data(), out.data(), base.size());
+    double error{0.0};
+    for (std::size_t i = 0; i < base.size(); ++i)
+        error = std::fmax(error, ulp_error(out[i](), std::pow(static_cast<long double>(base[i]()),
+                                                              static_cast<long double>(exponent[i]()))));
+    EXPECT_LT(error, 1.3);
+
+    stu::unit b[]{stu::unit{-2.0}, stu::unit{0.0}, stu::unit{1.0e300}, stu::unit{2.0}};
+    stu::unit e[]{stu::unit{3.0}, stu::unit{2.0}, stu::unit{2.0}, stu::unit{-1074.0}};
+    stu::unit fallback[4];
+    stu::pow<stu::accuracy::fast>(b, e, fallback, 4);
+    for (std::size_t i = 0; i < 4; ++i)
+        EXPECT_EQ(fallback[i](), std::pow(b[i](), e[i]()));
+}
+
+TEST(StrongUnitVMath, batch_precise_and_fallback)
+{
+    stu::unit in[]{stu::unit{-1.0}, stu::unit{0.0}, stu::unit{800.0}, stu::unit{-800.0}, stu::unit{0.5}};
+    stu::unit fast[5], precise[5];
+
+    stu::exp<stu::accuracy::fast>(in, fast, 5);
+    stu::exp(in, precise, 5);
+    for (std::size_t i = 0; i < 5; ++i)
+        EXPECT_EQ(precise[i](), std::exp(in[i]()));
+    EXPECT_EQ(fast[2](), std::exp(800.0));
+    EXPECT_EQ(fast[3](), 0.0);
+
+    stu::log<stu::accuracy::fast>(in, fast, 5);
+    EXPECT_TRUE(std::isnan(fast[0]()));
+    EXPECT_EQ(fast[1](), -INFINITY);
+    EXPECT_EQ(fast[4](), std::log(0.5));
+
+    stu::numeral_unit<float> f[]{stu::numeral_unit<float>{0.25f}, stu::numeral_unit<float>{2.0f}};
+    stu::numeral_unit<float> fout[2];
+    stu::tanh<stu::accuracy::fast>(f, fout, 2);
+    EXPECT_EQ(fout[0](), std::tanh(0.25f));
+    EXPECT_EQ(fout[1](), std::tanh(2.0f));
+}
+
+TEST(StrongUnitVMath, batch_in_place)
+{
+    std::vector<stu::unit> const in{stu::unit{-1.0}, stu::unit{0.0}, stu::unit{800.0}, stu::unit{-800.0},
+                                    stu::unit{0.5},  stu::unit{25.0}, stu::unit{NAN},  stu::unit{3.0}};
+    auto const in_place = [&in](auto function) {
+        std::vector<stu::unit> expected(in.size()), values{in};
+        function(in.data(), expected.data(), in.size());
+        function(values.data(), values.data(), values.size());
+        for (std::size_t i = 0; i < in.size(); ++i)
+            EXPECT_TRUE(values[i]() == expected[i]() || (std::isnan(values[i]()) && std::isnan(expected[i]()))) << i;
+        return values;
+    };
+
+    auto const exp = in_place([](auto in, auto out, auto n) { stu::exp<stu::accuracy::fast>(in, out, n); });
+    EXPECT_EQ(exp[2](), INFINITY);
+    EXPECT_EQ(exp[3](), 0.0);
+    auto const log = in_place([](auto in, auto out, auto n) { stu::log<stu::accuracy::fast>(in, out, n); });
+    EXPECT_TRUE(std::isnan(log[0]()));
+    EXPECT_EQ(log[1](), -INFINITY);
+    EXPECT_EQ(log[4](), std::log(0.5));
+    auto const log10 = in_place([](auto in, auto out, auto n) { stu::log10<stu::accuracy::fast>(in, out, n); });
+    EXPECT_EQ(log10[1](), -INFINITY);
+    auto const tanh = in_place([](auto in, auto out, auto n) { stu::tanh<stu::accuracy::fast>(in, out, n); });
+    EXPECT_EQ(tanh[5](), std::tanh(25.0));
+    in_place([](auto in, auto out, auto n) { stu::pow<stu::accuracy::fast>(in, stu::unit{-0.5}, out, n); });
+
+    stu::unit base[]{stu::unit{-2.0}, stu::unit{0.0}, stu::unit{1.0e300}, stu::unit{2.0}, stu::unit{9.0}};
+    stu::unit exponent[]{stu::unit{3.0}, stu::unit{2.0}, stu::unit{2.0}, stu::unit{-1074.0}, stu::unit{0.5}};
+    stu::unit values[5], expected[5];
+    std::copy(base, base + 5, values);
+    stu::pow<stu::accuracy::fast>(base, exponent, expected, 5);
+    stu::pow<stu::accuracy::fast>(values, exponent, values, 5);
+    for (std::size_t i = 0; i < 5; ++i)
+        EXPECT_EQ(values[i](), expected[i]()) << i;
+    std::copy(exponent, exponent + 5, values);
+    stu::pow<stu::accuracy::fast>(base, values, values, 5);
+    for (std::size_t i = 0; i < 5; ++i)
+        EXPECT_EQ(values[i](), expected[i]()) << i;
+    EXPECT_EQ(expected[0](), -8.0);
+    EXPECT_EQ(expected[2](), INFINITY);
+}
+
+TEST(StrongUnitVMath, wrap_angle)
+{
+    using degree = stu::numeral_deg<double>;
+    double const pi{3.14159265358979323846};
+    for (auto const &angle : angles())
+    {
+        double const wrapped{stu::wrap_angle(angle)()};
+        double const positive{stu::wrap_angle_positive(angle)()};
+        EXPECT_TRUE(wrapped >= -pi && wrapped < pi) << angle();
+        EXPECT_TRUE(positive >= 0.0 && positive < 2 * pi) << angle();
+        EXPECT_NEAR(std::remainder(wrapped - angle(), 2 * pi), 0.0, 1e-15 * (1.0 + std::fabs(angle()))) << angle();
+        EXPECT_NEAR(std::remainder(positive - angle(), 2 * pi), 0.0, 1e-15 * (1.0 + std::fabs(angle()))) << angle();
+    }
+    EXPECT_EQ(stu::wrap_angle(stu::rad{0.5})(), 0.5);
+    EXPECT_EQ(stu::wrap_angle(stu::rad{-1e-300})(), -1e-300);
+    EXPECT_EQ(stu::wrap_angle(stu::rad{pi})(), -pi);
+
+    EXPECT_EQ(stu::wrap_angle(degree{540.0})(), -180.0);
+    EXPECT_EQ(stu::wrap_angle(degree{180.0})(), -180.0);
+    EXPECT_EQ(stu::wrap_angle(degree{-180.0})(), -180.0);
+    EXPECT_EQ(stu::wrap_angle(degree{359.5})(), -0.5);
+    EXPECT_EQ(stu::wrap_angle(degree{3.6e14 + 90.0})(), 90.0);
+    EXPECT_EQ(stu::wrap_angle_positive(degree{-0.5})(), 359.5);
+    EXPECT_EQ(stu::wrap_angle_positive(degree{720.0})(), 0.0);
+    EXPECT_EQ(stu::wrap_angle_positive(degree{-1e300})(), std::fmod(std::fmod(-1e300, 360.0) + 360.0, 360.0));
+    EXPECT_TRUE(std::isnan(stu::wrap_angle(degree{INFINITY})()));
+    EXPECT_TRUE(std::isnan(stu::wrap_angle_positive(stu::rad{NAN})()));
+}
+
+TEST(StrongUnitVMath, batch_wrap_angle)
+{
+    auto in = angles();
+    in.push_back(stu::rad{1e300});
+    in.push_back(stu::rad{NAN});
+    std::vector<stu::rad> wrapped(in.size()), positive(in.size());
+    stu::wrap_angle(in.data(), wrapped.data(), in.size());
+    stu::wrap_angle_positive(in.data(), positive.data(), in.size());
+    for (std::size_t i = 0; i + 1 < in.size(); ++i)
+    {
+        EXPECT_EQ(wrapped[i](), stu::wrap_angle(in[i])()) << in[i]();
+        EXPECT_EQ(positive[i](), stu::wrap_angle_positive(in[i])()) << in[i]();
+    }
+    EXPECT_TRUE(std::isnan(wrapped.back()()));
+
+    std::vector<stu::numeral_deg<float>> degrees;
+    for (int i = -1000; i <= 1000; ++i)
+        degrees.push_back(stu::numeral_deg<float>{i * 7.25f});
+    auto expected = degrees;
+    for (auto &angle : expected)
+        angle = stu::wrap_angle(angle);
+    stu::wrap_angle(degrees.data(), degrees.data(), degrees.size()); // in place
+    for (std::size_t i = 0; i < degrees.size(); ++i)
+        EXPECT_EQ(degrees[i](), expected[i]());
+}
+
+TEST(StrongUnitVMath, unwrap_phase)
+{
+    using degree = stu::numeral_deg<double>;
+    std::vector<stu::rad> phase, wrapped;
+    for (int i = 0; i < 1000; ++i)
+    {
+        phase.push_back(stu::rad{2.5 - 0.3 * i + 0.001 * i * i});
+        wrapped.push_back(stu::wrap_angle(phase.back()));
+    }
+    std::vector<stu::rad> unwrapped(wrapped.size());
+    stu::unwrap_phase(wrapped.data(), unwrapped.data(), wrapped.size());
+    for (std::size_t i = 0; i < phase.size(); ++i)
+        EXPECT_NEAR(unwrapped[i](), phase[i](), 1e-9 * (1.0 + std::fabs(phase[i]())));
+
+    stu::unwrap_phase(wrapped.data(), wrapped.data(), wrapped.size()); // in place
+    for (std::size_t i = 0; i < phase.size(); ++i)
+        EXPECT_EQ(wrapped[i](), unwrapped[i]());
+
+    EXPECT_EQ(stu::unwrap_phase(degree{710.0}, degree{-5.0})(), 715.0);
+    EXPECT_EQ(stu::unwrap_phase(degree{-170.0}, degree{175.0})(), -185.0);
+    EXPECT_NEAR(stu::unwrap_phase(stu::rad{3.1}, stu::rad{-3.1})(), 2 * 3.14159265358979323846 - 3.1, 1e-15);
+}
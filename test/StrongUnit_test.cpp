@@ -6,13 +6,15 @@
  * @copyright Copyright (c) 2022
  * MIT License
  */
+#include <sstream>
 #include "gtest/gtest.h"
 #include "src/lib/StrongTypeDefinition.h"
-#include "src/lib/StrongUnit.h"
+#include "src/lib/StrongUnitIO.h"
 
 using namespace stu::literals;
 using namespace stu::symbols;
 using namespace stu::constants;
+using namespace stu::prefixed_literals;
 
 namespace stu
 {
@@ -24,12 +26,30 @@ namespace stu
     DEF_SCALE(unity, 1U)
     DEF_SCALE(kilo, 1000U)
     DEF_SCALE(s2min, 60U)
+    DEF_SCALE(giga, 1000000000U)
+    DEF_SCALE(milli, 1U, 1000U)
+    DEF_SCALE(num2rad, 1U, 2U, -1)
+    DEF_SCALE(num2deg, 1U, 360U)
 
     DEF_UNIT(Length, meter, STU_UNIT_TYPE, _m, unity)
-    DEF_UNIT(Length, kilometer, STU_UNIT_TYPE, _km, kilo)
+    DEF_NAMED_UNIT(Length, kilometer, STU_UNIT_TYPE, _km, kilo)
+    DEF_UNIT(Length, gigameter, STU_UNIT_TYPE, _Gm, giga)
     DEF_UNIT(Time, second, STU_UNIT_TYPE, _s, unity)
     DEF_UNIT(Time, minute, STU_UNIT_TYPE, _min, s2min)
-    DEF_UNIT(Velocity, meter_per_second, STU_UNIT_TYPE, _mps, unity)
+    DEF_NAMED_UNIT(Velocity, meter_per_second, STU_UNIT_TYPE, _mps, unity)
+    DEF_UNIT(Numeral, radian, STU_UNIT_TYPE, _rad, num2rad)
+    DEF_UNIT(Numeral, degree, STU_UNIT_TYPE, _deg, num2deg)
+
+    DEF_PREFIXED_LITERAL(second, s, m, milli)
+    DEF_PREFIXED_LITERAL(meter, m, m, milli)
+    DEF_PREFIXED_LITERAL(radian, rad, m, milli)
+}
+
+/* DEF_UNIT works in any namespace and for units having the quantity and scale of another unit */
+namespace user_units
+{
+    DEF_UNIT(stu::Length, metre, STU_UNIT_TYPE, _metre, stu::unity)
+    DEF_UNIT(stu::Velocity, metre_per_second, STU_UNIT_TYPE, _metre_per_s, stu::unity)
 }
 
 // Allowed wrapped types
@@ -53,6 +73,18 @@ TEST(StrongUnit, Implicit_conversion_Time)
     EXPECT_EQ(m(), 0.5);
 }
 
+TEST(StrongUnit, Constexpr_integer_literals)
+{
+    constexpr stu::meter a = 3_m;
+    constexpr stu::meter b = 3.0_m;
+    EXPECT_EQ(a, b);
+
+    constexpr auto c = 1500_ms;
+    stu::second d = c;
+    EXPECT_EQ(d, 1.5_s);
+    EXPECT_EQ(2500.0_mm, 2.5_m);
+}
+
 TEST(StrongUnit, Addition_compound_length)
 {
     stu::meter a = 10.0_m;
@@ -245,8 +277,17 @@ TEST(StrongUnit, units_modulo_conversion)
 {
     auto sec = 130.9_s;
     auto sec1 = 60.1_s;
-    sec %= sec1; // 130.0_s and 60.0_s are actually considered (floating point to integer conversion)
-    EXPECT_EQ(sec, 10.0_s);
+    sec %= sec1; // std::fmod: 130.9 - 2 * 60.1
+    EXPECT_NEAR(sec(), 10.7, 1e-12);
+
+    sec = 7.5_s % 2.0_s;
+    EXPECT_EQ(sec, 1.5_s);
+
+    sec = stu::second{-7.5} % 2.0_s; // the result has the sign of the dividend
+    EXPECT_EQ(sec, stu::second{-1.5});
+
+    sec = 6.0e9_s % 7.0_s; // beyond the int range
+    EXPECT_EQ(sec(), std::fmod(6.0e9, 7.0));
 
     sec = 130.0_s;
     auto min = 1.0_min;
@@ -332,6 +373,21 @@ TEST(StrongUnit, units_round_conversion)
     EXPECT_EQ(stu::round(d), -1 * 2.0_m);
 }
 
+TEST(StrongUnit, units_chained_scales)
+{
+    auto a = (2.0_Gm * 3.0_Gm) / (1.0_Gm * 1.0_Gm);
+    EXPECT_EQ(a, 6.0 * _1);
+
+    auto b = stu::pow<2>(1.0_Gm) * stu::pow<-2>(2.0_Gm);
+    EXPECT_EQ(b, 0.25 * _1);
+
+    using gm2_scale = stu::Scale<1000000000000000000U>;
+    using small_scale = stu::Scale<27U, 1000000000000000000U>;
+    EXPECT_TRUE((std::is_same<stu::utils::mul_scales_t<gm2_scale, small_scale>, stu::Scale<27U>>::value));
+    EXPECT_TRUE((std::is_same<stu::utils::div_scales_t<small_scale, small_scale>, stu::Scale<1U>>::value));
+    EXPECT_TRUE((std::is_same<stu::utils::pow_scales_t<stu::Scale<1U, 1000U>, -3>, stu::Scale<1000000000U>>::value));
+}
+
 TEST(StrongUnit, units_exp_conversion)
 {
     stu::meter b = 0.002_km;
@@ -495,6 +551,49 @@ TEST(StrongUnit, units_pow_conversion)
     EXPECT_EQ(cc(), 1 / dd);
 }
 
+TEST(StrongUnit, units_integer_pow_expansion)
+{
+    stu::meter b = 3.0_m;
+    EXPECT_EQ(stu::pow<0>(b)(), 1.0);
+    EXPECT_EQ(stu::pow<1>(b), b);
+    EXPECT_EQ(stu::pow<3>(b)(), 27.0);
+    EXPECT_EQ(stu::pow<5>(b)(), 243.0);
+    EXPECT_EQ(stu::pow<-3>(b)(), 1.0 / 27.0);
+
+    stu::kilometer c = stu::pow<3>(b) / stu::pow<2>(b);
+    EXPECT_EQ(c, b);
+}
+
+TEST(StrongUnit, units_rational_pow)
+{
+    stu::meter b = 4.0_m;
+    auto a = stu::pow<3, 2>(b);
+    EXPECT_EQ(a(), 8.0);
+    EXPECT_EQ(stu::sqrt(stu::pow<3>(b)), a);
+
+    auto c = stu::pow<-1, 2>(b);
+    EXPECT_EQ(c(), 0.5);
+    EXPECT_EQ(c * stu::sqrt(b), _1);
+
+    auto d = stu::cbrt(stu::pow<3>(3.0_km));
+    stu::kilometer dd = d;
+    EXPECT_DOUBLE_EQ(dd(), 3.0);
+    EXPECT_DOUBLE_EQ(stu::root<3>(27.0_m)(), 3.0);
+    EXPECT_DOUBLE_EQ((stu::pow<2, 3>(8.0_m)()), 4.0);
+    EXPECT_DOUBLE_EQ((stu::pow<4, 2>(3.0_m)()), 9.0);
+    EXPECT_DOUBLE_EQ((stu::pow<1, 4>(16.0_m)()), 2.0);
+
+    stu::meter e = stu::pow<2, 3>(stu::pow<3, 2>(b));
+    EXPECT_EQ(e, b);
+
+    auto const negative = stu::pow<5>(stu::meter{-2.0});
+    EXPECT_DOUBLE_EQ(stu::root<5>(negative)(), -2.0);
+    EXPECT_DOUBLE_EQ((stu::pow<3, 5>(negative)()), -8.0);
+    EXPECT_DOUBLE_EQ((stu::pow<-1, 5>(negative)()), -0.5);
+    EXPECT_DOUBLE_EQ(stu::cbrt(stu::pow<3>(stu::meter{-3.0}))(), -3.0);
+    EXPECT_TRUE(std::isnan((stu::pow<1, 4>(stu::pow<4>(2.0_m) * -1.0)())));
+}
+
 TEST(StrongUnit, units_sqrt_conversion)
 {
     auto b = 5.0_km * 5.0_km;
@@ -508,5 +607,85 @@ TEST(StrongUnit, units_sqrt_conversion)
     EXPECT_EQ(a(), dd * 1000);
 }
 
+TEST(StrongUnit, units_sqrt_prefixed_scale)
+{
+    auto b = 3.0_Gm * 3.0_Gm; // 10^18 scale
+    stu::gigameter d = stu::sqrt(b);
+    EXPECT_EQ(d, 3.0_Gm);
+
+    constexpr auto root2 = stu::utils::isqrt(1000000000000000000U);
+    constexpr auto root3 = stu::utils::iroot(1000000000000000000U, 3);
+    constexpr auto no_root = stu::utils::iroot(999999999999999999U, 2);
+    EXPECT_EQ(root2, 1000000000U);
+    EXPECT_EQ(root3, 1000000U);
+    EXPECT_EQ(no_root, 0U);
+    EXPECT_EQ(stu::utils::iroot(UINTMAX_MAX, 1), UINTMAX_MAX);
+    EXPECT_EQ(stu::utils::isqrt(0), 0U);
+}
+
+TEST(StrongUnit, units_canonical_result_types)
+{
+    using velocity = decltype(1.0_m / 1.0_s);
+    EXPECT_TRUE((std::is_same<velocity, stu::meter_per_second>::value));
+    EXPECT_TRUE((std::is_same<decltype((1.0_m * 1.0_s) / (1.0_s * 1.0_s)), stu::meter_per_second>::value));
+    EXPECT_TRUE((std::is_same<decltype(stu::sqrt(1.0_km * 1.0_km)), stu::kilometer>::value));
+    EXPECT_TRUE((std::is_same<decltype(1.0_m / 1.0_m), stu::unit>::value));
+    EXPECT_TRUE((std::is_same<decltype(1.0_m * 1.0_s), decltype(1.0_s * 1.0_m)>::value));
+    EXPECT_TRUE((std::is_same<decltype(1.0_m * 1.0_km), decltype(1.0_km * 1.0_m)>::value));
+    EXPECT_FALSE((std::is_same<decltype(1.0_m * 1.0_m), decltype(1.0_km * 1.0_km)>::value));
+
+    auto a = (3.0_m * 2.0_s) / (2.0_s * 1.0_s);
+    EXPECT_EQ(a, 3.0_mps);
+    EXPECT_EQ(stu::label(a * a), "b0^-2*b1^2");
+}
+
+TEST(StrongUnit, units_unnamed_definitions)
+{
+    using namespace user_units::literals;
+    stu::meter a = 2.0_metre;
+    EXPECT_EQ(a, 2.0_m);
+    EXPECT_TRUE((std::is_same<decltype(2.0_metre / 1.0_s), stu::meter_per_second>::value));
+    user_units::metre_per_second v = 2.0_metre / 1.0_s;
+    EXPECT_EQ(v(), 2.0);
+    EXPECT_EQ(std::string{user_units::tag::_metre::name()}, "_metre");
+}
+
+TEST(StrongUnit, units_pi_scales)
+{
+    stu::radian half_turn = 180.0_deg;
+    EXPECT_EQ(half_turn(), static_cast<double>(3.141592653589793238462643383279502884L));
+
+    stu::degree a = 1.0_rad;
+    EXPECT_DOUBLE_EQ(a(), 57.295779513082320876798154814105170L);
+
+    stu::unit turns = 3.0_rad;
+    EXPECT_DOUBLE_EQ(turns(), 3.0 / (2.0 * 3.141592653589793238462643383279502884L));
+
+    stu::radian b = 1500_mrad;
+    EXPECT_EQ(b, 1.5_rad);
+
+    auto sr = 2.0_rad * 2.0_rad;
+    EXPECT_TRUE((decltype(sr)::scale::pi_ == -2));
+    EXPECT_EQ(stu::sqrt(sr), 2.0_rad);
+
+    EXPECT_EQ(stu::sin(90.0_deg)(), 1.0);
+    EXPECT_EQ(stu::cos(0.0_deg)(), 1.0);
+    EXPECT_NEAR(stu::cos(60.0_deg)(), 0.5, 1e-15);
+    EXPECT_NEAR(stu::tan(45.0_deg)(), 1.0, 1e-15);
+}
+
+TEST(StrongUnit, units_stream_io)
+{
+    std::stringstream ss;
+    ss << 2.5_km << " " << 1.0_m / 1.0_s << " " << 2.0_m * 1.0_s;
+    EXPECT_EQ(ss.str(), "2.5*_km 1*_mps 2*b0*b1");
+
+    stu::meter a{};
+    std::stringstream in{"4.5"};
+    in >> a;
+    EXPECT_EQ(a, 4.5_m);
+    EXPECT_EQ(stu::label(a), "_m");
+}
+
 /*/
-//*/
\ No newline at end of file
+//*/
\ No newline at end of file
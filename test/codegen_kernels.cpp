@@ -0,0 +1,158 @@
+/**
+ * @file codegen_kernels.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Reference kernels (sum, axpy, scalar scale, conversion, integer power,
+ * complex multiply, affine conversion, duration conversion)
+ * for the code generation regression test.
+ * The same source is compiled once with strong units and once with raw
+ * floating-point types (`STU_CODEGEN_RAW`), see `codegen_test.sh`.
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#include <chrono>
+#include <cstddef>
+
+#ifdef STU_CODEGEN_RAW
+
+using factor_t = double;
+using length_t = double;
+using klength_t = double;
+
+struct clength_t
+{
+    double re;
+    double im;
+};
+using carea_t = clength_t;
+using celsius_t = double;
+using fahrenheit_t = double;
+using second_t = double;
+
+inline carea_t cmul(clength_t const &first, clength_t const &second)
+{
+    return carea_t{first.re * second.re - first.im * second.im,
+                   first.re * second.im + second.re * first.im};
+}
+
+inline klength_t to_kilometer(length_t const &value)
+{
+    return value / 1000.0;
+}
+
+inline double cubed(double value)
+{
+    return value * value * value;
+}
+
+inline fahrenheit_t to_fahrenheit(celsius_t const &value)
+{
+    return value * 1.8 + 32.0;
+}
+
+inline second_t to_second(std::chrono::nanoseconds const &value)
+{
+    return static_cast<double>(value.count()) * 1e-9;
+}
+
+#else
+
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/SIDerivedUnits.h"
+#include "src/lib/NonSIBaseUnits.h"
+#include "src/lib/StrongCUnit.h"
+#include "src/lib/StrongUnitChrono.h"
+
+namespace stu
+{
+    DEF_UNIT(quantity::length, kilometer, STU_UNIT_TYPE, _km, scale::kilo)
+}
+
+using factor_t = stu::unit;
+using length_t = stu::meter;
+using klength_t = stu::kilometer;
+using clength_t = stu::CUnit<stu::meter>;
+using carea_t = decltype(clength_t{} * clength_t{});
+using celsius_t = stu::celsius;
+using fahrenheit_t = stu::fahrenheit;
+using second_t = stu::second;
+
+inline carea_t cmul(clength_t const &first, clength_t const &second)
+{
+    return first * second;
+}
+
+inline klength_t to_kilometer(length_t const &value)
+{
+    return value;
+}
+
+inline auto cubed(length_t const &value)
+{
+    return stu::pow<3>(value);
+}
+
+inline fahrenheit_t to_fahrenheit(celsius_t const &value)
+{
+    return value;
+}
+
+inline second_t to_second(std::chrono::nanoseconds const &value)
+{
+    return stu::from_duration(value);
+}
+
+#endif
+
+extern "C"
+{
+    length_t kernel_sum(length_t const *x, std::size_t size)
+    {
+        length_t res{0};
+        for (std::size_t i = 0; i < size; ++i)
+            res += x[i];
+        return res;
+    }
+
+    void kernel_axpy(factor_t a, length_t const *x, length_t *y, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            y[i] = a * x[i] + y[i];
+    }
+
+    void kernel_scale(length_t const *x, length_t *y, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            y[i] = 1.1 * x[i] / 3.0;
+    }
+
+    void kernel_conversion(length_t const *x, klength_t *y, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            y[i] = to_kilometer(x[i]);
+    }
+
+    void kernel_power(factor_t a, length_t const *x, length_t *y, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            y[i] = a * cubed(x[i]) / (x[i] * x[i]);
+    }
+
+    void kernel_complex_multiply(clength_t const *x, clength_t const *y, carea_t *z, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            z[i] = cmul(x[i], y[i]);
+    }
+
+    void kernel_affine_conversion(celsius_t const *x, fahrenheit_t *y, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            y[i] = to_fahrenheit(x[i]);
+    }
+
+    void kernel_duration_conversion(std::chrono::nanoseconds const *x, second_t *y, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            y[i] = to_second(x[i]);
+    }
+}
@@ -0,0 +1,97 @@
+#!/bin/bash
+#
+# @file codegen_test.sh
+# @author Massimo Mattelliano (mattemax@yahoo.com)
+# @brief
+# Code generation regression test for StrongUnit.
+# It compiles the reference kernels of `codegen_kernels.cpp` once with strong
+# units and once with raw floating-point types, then it fails if the strong
+# unit version loses a vectorized loop or gains a function call, if the
+# core headers emit the iostream static initializer, or if they include the
+# string or stream headers.
+# @copyright Copyright (c) 2022
+# MIT License
+
+set -u
+
+if [ -n "${TEST_SRCDIR:-}" ]; then
+    ROOT="${TEST_SRCDIR}/${TEST_WORKSPACE}"
+else
+    ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+fi
+CXX="${CXX:-c++}"
+WORK="$(mktemp -d "${TEST_TMPDIR:-/tmp}/stu_codegen.XXXXXX")"
+trap 'rm -rf "${WORK}"' EXIT
+
+KERNELS="kernel_sum kernel_axpy kernel_scale kernel_conversion kernel_power kernel_complex_multiply kernel_affine_conversion kernel_duration_conversion"
+STATUS=0
+
+# compile <variant> <opt> [flags...] : assembly and vectorization report
+compile()
+{
+    local variant=$1
+    local opt=$2
+    shift 2
+    "${CXX}" -std=c++14 "${opt}" -I"${ROOT}" "$@" -S "${ROOT}/test/codegen_kernels.cpp" \
+        -o "${WORK}/${variant}${opt}.s" -fopt-info-vec-optimized="${WORK}/${variant}${opt}.vec" ||
+        { echo "FAILED to compile ${variant} kernels (${opt})"; exit 1; }
+}
+
+# calls <asm> <kernel> : number of call (and tail call) instructions of a kernel
+calls()
+{
+    awk -v fn="$2:" '$1 == fn { on = 1; next }
+                     on && /\.cfi_endproc/ { exit }
+                     on && ($1 == "call" || ($1 == "jmp" && $2 !~ /^\.L/)) { n++ }
+                     END { print n + 0 }' "$1"
+}
+
+# vectorized <report> : source locations of vectorized loops
+vectorized()
+{
+    grep "loop vectorized" "$1" | sed 's/^[^:]*:\([0-9]*:[0-9]*\):.*/\1/' | sort -u
+}
+
+for OPT in -O2 -O3; do
+    compile unit "${OPT}"
+    compile raw "${OPT}" -DSTU_CODEGEN_RAW
+
+    MISSING=$(comm -13 <(vectorized "${WORK}/unit${OPT}.vec") <(vectorized "${WORK}/raw${OPT}.vec"))
+    if [ -n "${MISSING}" ]; then
+        echo "FAIL ${OPT}: loops not vectorized with strong units at" ${MISSING}
+        STATUS=1
+    fi
+
+    for KERNEL in ${KERNELS}; do
+        UNIT_CALLS=$(calls "${WORK}/unit${OPT}.s" "${KERNEL}")
+        RAW_CALLS=$(calls "${WORK}/raw${OPT}.s" "${KERNEL}")
+        if [ "${UNIT_CALLS}" -gt "${RAW_CALLS}" ]; then
+            echo "FAIL ${OPT}: ${KERNEL} has ${UNIT_CALLS} calls with strong units, ${RAW_CALLS} with raw types"
+            STATUS=1
+        else
+            echo "OK   ${OPT}: ${KERNEL}"
+        fi
+    done
+
+    if grep -q "ios_base4Init" "${WORK}/unit${OPT}.s"; then
+        echo "FAIL ${OPT}: strong unit core headers emit the iostream static initializer"
+        STATUS=1
+    fi
+done
+
+# the core and SI headers must not include the string and stream headers (parse cost of every unit TU)
+if ! DEPS=$(printf '#include "src/lib/%s"\n' StrongTypeDefinition.h SIDerivedUnits.h \
+                SISpecialDerivedUnits.h SIPrefixedLiterals.h NonSIBaseUnits.h |
+            "${CXX}" -std=c++14 -I"${ROOT}" -M -x c++ -); then
+    echo "FAIL: core headers do not preprocess"
+    STATUS=1
+fi
+HEAVY=$(echo "${DEPS}" | tr ' \\' '\n\n' | grep -E '/(string|stdexcept|iostream|ostream|istream|sstream)$')
+if [ -n "${HEAVY}" ]; then
+    echo "FAIL: core headers include" ${HEAVY}
+    STATUS=1
+elif [ -n "${DEPS}" ]; then
+    echo "OK   : core headers include no string or stream header"
+fi
+
+exit ${STATUS}
@@ -0,0 +1,64 @@
+#!/bin/bash
+#
+# @file link_size_test.sh
+# @author Massimo Mattelliano (mattemax@yahoo.com)
+# @brief
+# Link size test for StrongUnit symbols, prefixes and constants.
+# It links many objects of `link_size_tus.cpp` and it fails if they do not share
+# a single definition of each symbol, or if the number of strong unit data
+# symbols of the binary grows with the number of objects.
+# @copyright Copyright (c) 2022
+# MIT License
+
+set -u
+
+if [ -n "${TEST_SRCDIR:-}" ]; then
+    ROOT="${TEST_SRCDIR}/${TEST_WORKSPACE}"
+else
+    ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+fi
+CXX="${CXX:-c++}"
+WORK="$(mktemp -d "${TEST_TMPDIR:-/tmp}/stu_link_size.XXXXXX")"
+trap 'rm -rf "${WORK}"' EXIT
+
+TUS=16
+STATUS=0
+
+# build <std> <objects> : binary linking the given number of objects
+build()
+{
+    local std=$1
+    local count=$2
+    local objects=()
+    for ((i = 0; i < count; ++i)); do
+        "${CXX}" -std="${std}" -O2 -I"${ROOT}" -c "${ROOT}/test/link_size_tus.cpp" -o "${WORK}/tu${i}.o" ||
+            { echo "FAILED to compile translation unit (${std})"; exit 1; }
+        objects+=("${WORK}/tu${i}.o")
+    done
+    "${CXX}" -std="${std}" -O2 -DSTU_LINK_SIZE_MAIN -I"${ROOT}" "${ROOT}/test/link_size_tus.cpp" \
+        "${objects[@]}" -o "${WORK}/bin${count}" || { echo "FAILED to link (${std})"; exit 1; }
+}
+
+# data_symbols <binary> : number of strong unit data symbols
+data_symbols()
+{
+    nm -C "$1" | grep -E ' [bBdDrRuvV] ' | grep -c 'stu::'
+}
+
+for STD in c++14 c++17; do
+    build "${STD}" 1
+    build "${STD}" "${TUS}"
+
+    "${WORK}/bin${TUS}" || STATUS=1
+
+    ONE=$(data_symbols "${WORK}/bin1")
+    MANY=$(data_symbols "${WORK}/bin${TUS}")
+    if [ "${MANY}" -gt "${ONE}" ]; then
+        echo "FAIL ${STD}: ${MANY} strong unit data symbols with ${TUS} objects, ${ONE} with one object"
+        STATUS=1
+    else
+        echo "OK   ${STD}: ${MANY} strong unit data symbols with ${TUS} objects"
+    fi
+done
+
+exit ${STATUS}
@@ -0,0 +1,74 @@
+/**
+ * @file link_size_tus.cpp
+ * @author Massimo Mattelliano (mattemax@yahoo.com)
+ * @brief
+ * Translation unit of the link size test: it is compiled many times, each object
+ * ODR-uses strong unit symbols, prefixes and constants and registers their addresses.
+ * With `STU_LINK_SIZE_MAIN` it is the test driver, checking that every object refers
+ * to the same definitions, see `link_size_test.sh`.
+ * @copyright Copyright (c) 2022
+ * MIT License
+ */
+#include <cstddef>
+
+namespace link_size
+{
+    constexpr std::size_t symbols_count{8};
+
+    void register_symbols(void const *const *symbols);
+}
+
+#ifdef STU_LINK_SIZE_MAIN
+
+#include <cstdio>
+#include <vector>
+
+namespace link_size
+{
+    std::vector<void const *const *> &registry()
+    {
+        static std::vector<void const *const *> tus;
+        return tus;
+    }
+
+    void register_symbols(void const *const *symbols)
+    {
+        registry().push_back(symbols);
+    }
+}
+
+int main()
+{
+    auto const &tus = link_size::registry();
+    for (auto tu : tus)
+        for (std::size_t i = 0; i < link_size::symbols_count; ++i)
+            if (tu[i] != tus.front()[i])
+            {
+                std::printf("FAIL: symbol %zu has different definitions across translation units\n", i);
+                return 1;
+            }
+    std::printf("OK   %zu translation units share the same symbol definitions\n", tus.size());
+    return 0;
+}
+
+#else
+
+#include "src/lib/StrongTypeDefinition.h"
+#include "src/lib/SIDerivedUnits.h"
+#include "src/lib/StrongCUnit.h"
+
+namespace
+{
+    void const *const symbols[link_size::symbols_count] = {&stu::symbols::_m,
+                                                           &stu::symbols::_s,
+                                                           &stu::symbols::_V,
+                                                           &stu::prefixes::k_,
+                                                           &stu::constants::PI,
+                                                           &stu::constants::_0,
+                                                           &stu::constants::_1,
+                                                           &stu::constants::j};
+
+    int const registered = (link_size::register_symbols(symbols), 0);
+}
+
+#endif